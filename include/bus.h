@@ -29,6 +29,26 @@
 
 #include <common.h>
 
+#define DMGL_BUS_CLOCK 4194304  /*!< Bus clock rate, in cycles per second */
+#define DMGL_BUS_FRAME 70224    /*!< Bus cycles per frame (154 lines of 456 cycles) */
+#define DMGL_BUS_SAMPLE 1024    /*!< Bus sample histogram initial capacity, in entries */
+
+/*!
+ * @struct dmgl_bus_t
+ * @brief Bus context (opaque).
+ */
+typedef struct dmgl_bus_s dmgl_bus_t;
+
+/*!
+ * @enum dmgl_event_e
+ * @brief Bus event types.
+ */
+typedef enum {
+    DMGL_EVENT_FRAME = 0,       /*!< Frame event type */
+    DMGL_EVENT_VIDEO,           /*!< Video event type */
+    DMGL_EVENT_MAX,             /*!< Max event type */
+} dmgl_event_e;
+
 /*!
  * @enum dmgl_interrupt_e
  * @brief Bus interrupt types.
@@ -47,53 +67,149 @@ extern "C" {
 #endif /* __cplusplus */
 
 /*!
- * @brief Clock bus interface.
+ * @brief Query bus block key, for caching decoded code at byte address.
+ * @param[in] bus Constant pointer to bus context
+ * @param[in] address Byte address
+ * @return Block key, keyed by ROM bank (high 16 bits) and address (low 16 bits), UINT32_MAX if address is not in mapped ROM
+ */
+uint32_t dmgl_bus_block(const dmgl_bus_t *bus, uint16_t address);
+
+/*!
+ * @brief Clock bus interface until the nearest scheduled event.
+ * @param[in,out] bus Pointer to bus context
  * @return DMGL_SUCCESS or DMGL_COMPLETE on success, DMGL_FAILURE otherwise
  */
-dmgl_error_e dmgl_bus_clock(void);
+dmgl_error_e dmgl_bus_clock(dmgl_bus_t *bus);
+
+/*!
+ * @brief Query bus cycle counter.
+ * @param[in] bus Constant pointer to bus context
+ * @return Bus cycles elapsed since initialization
+ */
+uint64_t dmgl_bus_cycle(const dmgl_bus_t *bus);
+
+/*!
+ * @brief Query bus frame pixel buffer.
+ * @param[in] bus Constant pointer to bus context
+ * @return Constant pointer to 160x144 pixel colors, row-major
+ */
+const uint8_t *dmgl_bus_frame(const dmgl_bus_t *bus);
+
+/*!
+ * @brief Fork bus interface, sharing ROM and copy-on-write RAM pages with parent.
+ * @param[in,out] bus Pointer to bus context pointer
+ * @param[in,out] parent Pointer to parent bus context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_bus_fork(dmgl_bus_t **bus, dmgl_bus_t *parent);
+
+/*!
+ * @brief Query bus interface hot-PC sample histogram, keyed by ROM bank (high 16 bits) and instruction address (low 16 bits).
+ * @param[in] bus Constant pointer to bus context
+ * @return Constant pointer to sample histogram, NULL if sampling is disabled
+ */
+const dmgl_histogram_t *dmgl_bus_histogram(const dmgl_bus_t *bus);
 
 /*!
  * @brief Initialize bus interface.
+ * @param[in,out] bus Pointer to bus context pointer, allocated by this call
  * @param[in] context Constant pointer to DMGL context
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
-dmgl_error_e dmgl_bus_initialize(const dmgl_t *context);
+dmgl_error_e dmgl_bus_initialize(dmgl_bus_t **bus, const dmgl_t *context);
 
 /*!
  * @brief Interrupt bus interface.
+ * @param[in,out] bus Pointer to bus context
  * @param[in] interrupt Byte interrupt type
  */
-void dmgl_bus_interrupt(dmgl_interrupt_e interrupt);
+void dmgl_bus_interrupt(dmgl_bus_t *bus, dmgl_interrupt_e interrupt);
+
+/*!
+ * @brief Load bus interface state.
+ * @param[in,out] bus Pointer to bus context
+ * @param[in] data Constant pointer to state data
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_bus_load(dmgl_bus_t *bus, const uint8_t *data);
+
+#if PROFILE
+
+/*!
+ * @brief Query bus interface opcode profile.
+ * @param[in] bus Constant pointer to bus context
+ * @param[out] profile Pointer to opcode profile context
+ */
+void dmgl_bus_profile(const dmgl_bus_t *bus, dmgl_profile_t *profile);
+#endif /* PROFILE */
 
 /*!
  * @brief Read byte from bus interface.
+ * @param[in] bus Constant pointer to bus context
  * @param[in] address Byte address
  * @return Byte value
  */
-uint8_t dmgl_bus_read(uint16_t address);
+uint8_t dmgl_bus_read(const dmgl_bus_t *bus, uint16_t address);
 
 /*!
  * @brief Reset bus interface.
+ * @param[in,out] bus Pointer to bus context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_bus_reset(dmgl_bus_t *bus);
+
+/*!
+ * @brief Save bus interface state.
+ * @param[in] bus Constant pointer to bus context
+ * @param[out] data Pointer to state data, NULL to query length only
+ * @return State length, in bytes
+ */
+size_t dmgl_bus_save(const dmgl_bus_t *bus, uint8_t *data);
+
+/*!
+ * @brief Enable bus interface hot-PC sampling, recording the current instruction address every interval.
+ * @param[in,out] bus Pointer to bus context
+ * @param[in] interval Sample interval, in cycles
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_bus_sample(dmgl_bus_t *bus, uint32_t interval);
+
+/*!
+ * @brief Schedule bus event.
+ * @param[in,out] bus Pointer to bus context
+ * @param[in] event Event type
+ * @param[in] delay Event delay from current bus cycle, in cycles
+ */
+void dmgl_bus_schedule(dmgl_bus_t *bus, dmgl_event_e event, uint32_t delay);
+
+/*!
+ * @brief Query decoded bus tile.
+ * @param[in,out] bus Pointer to bus context
+ * @param[in] tile Tile index [0-383]
+ * @return Constant pointer to 8x8 tile color indices, row-major
  */
-void dmgl_bus_reset(void);
+const uint8_t *dmgl_bus_tile(dmgl_bus_t *bus, uint16_t tile);
 
 /*!
  * @brief Query bus title string.
+ * @param[in] bus Constant pointer to bus context
  * @return Constant pointer to bus title string
  */
-const char *dmgl_bus_title(void);
+const char *dmgl_bus_title(const dmgl_bus_t *bus);
 
 /*!
  * @brief Uninitialize bus interface.
+ * @param[in,out] bus Pointer to bus context, freed by this call
  */
-void dmgl_bus_uninitialize(void);
+void dmgl_bus_uninitialize(dmgl_bus_t *bus);
 
 /*!
  * @brief Write byte to bus interface.
+ * @param[in,out] bus Pointer to bus context
  * @param[in] address Byte address
  * @param[in] value Byte value
  */
-void dmgl_bus_write(uint16_t address, uint8_t value);
+void dmgl_bus_write(dmgl_bus_t *bus, uint16_t address, uint8_t value);
 
 #ifdef __cplusplus
 }
@@ -30,5 +30,9 @@
 #include <buffer.h>
 #include <checksum.h>
 #include <error.h>
+#include <histogram.h>
+#include <page.h>
+#include <pixel.h>
+#include <rewind.h>
 
 #endif /* DMGL_COMMON_H_ */
@@ -27,8 +27,20 @@
 #ifndef DMGL_BUFFER_H_
 #define DMGL_BUFFER_H_
 
+#include <stdatomic.h>
 #include <define.h>
 
+/*!
+ * @struct dmgl_buffer_arena_t
+ * @brief Buffer arena, carving allocations out of one contiguous buffer, freed once its owner and every allocation are released.
+ */
+typedef struct {
+    atomic_size_t reference;                /*!< Arena reference count, one for its owner plus one per allocation */
+    size_t length;                          /*!< Arena length, in bytes */
+    size_t offset;                          /*!< Arena allocation offset, in bytes */
+    _Alignas(max_align_t) uint8_t data[];   /*!< Arena data */
+} dmgl_buffer_arena_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -40,6 +52,27 @@ extern "C" {
  */
 void *dmgl_buffer_allocate(size_t length);
 
+/*!
+ * @brief Dynamically allocate buffer arena, owned by the caller until released.
+ * @param[in] length Length of arena, in bytes
+ * @return Pointer to arena on success, NULL otherwise
+ */
+dmgl_buffer_arena_t *dmgl_buffer_arena_allocate(size_t length);
+
+/*!
+ * @brief Allocate zeroed buffer from arena, holding a reference on the arena until released.
+ * @param[in,out] arena Pointer to arena
+ * @param[in] length Length of buffer, in bytes
+ * @return Pointer to buffer on success, NULL if the arena is exhausted
+ */
+void *dmgl_buffer_arena_claim(dmgl_buffer_arena_t *arena, size_t length);
+
+/*!
+ * @brief Release arena reference, freeing the arena with its last reference.
+ * @param[in,out] arena Pointer to arena
+ */
+void dmgl_buffer_arena_release(dmgl_buffer_arena_t *arena);
+
 /*!
  * @brief Free allocated buffer.
  * @param[in] buffer Pointer to buffer
@@ -42,6 +42,14 @@ extern "C" {
  */
 uint8_t dmgl_checksum(const void *data, size_t begin, size_t end);
 
+/*!
+ * @brief Calculate 64-bit hash over data (FNV-1a).
+ * @param[in] data Constant pointer to data
+ * @param[in] length Data length, in bytes
+ * @return Hash value
+ */
+uint64_t dmgl_hash(const void *data, size_t length);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,91 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file histogram.h
+ * @brief Common sample histogram.
+ */
+
+#ifndef DMGL_HISTOGRAM_H_
+#define DMGL_HISTOGRAM_H_
+
+#include <define.h>
+
+/*!
+ * @struct dmgl_histogram_entry_t
+ * @brief Histogram entry, counting samples of one key.
+ */
+typedef struct {
+    uint32_t key;                   /*!< Entry key */
+    uint32_t count;                 /*!< Entry sample count, 0 if unused */
+} dmgl_histogram_entry_t;
+
+/*!
+ * @struct dmgl_histogram_t
+ * @brief Histogram context, an open-addressed table of entries.
+ */
+typedef struct {
+    dmgl_histogram_entry_t *entry;  /*!< Entry table */
+    size_t capacity;                /*!< Entry table capacity, power of two */
+    size_t length;                  /*!< Used entry count */
+    uint64_t total;                 /*!< Total sample count */
+} dmgl_histogram_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Add sample to histogram, growing the entry table as needed.
+ * @param[in,out] histogram Pointer to histogram context
+ * @param[in] key Sample key
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_histogram_increment(dmgl_histogram_t *histogram, uint32_t key);
+
+/*!
+ * @brief Initialize histogram context.
+ * @param[in,out] histogram Pointer to histogram context
+ * @param[in] capacity Initial entry table capacity, power of two
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_histogram_initialize(dmgl_histogram_t *histogram, size_t capacity);
+
+/*!
+ * @brief Query histogram entries with the highest sample counts.
+ * @param[in] histogram Constant pointer to histogram context
+ * @param[out] entry Pointer to entry array, sorted by descending sample count
+ * @param[in] count Maximum entry count
+ * @return Entry count
+ */
+size_t dmgl_histogram_top(const dmgl_histogram_t *histogram, dmgl_histogram_entry_t *entry, size_t count);
+
+/*!
+ * @brief Uninitialize histogram context.
+ * @param[in,out] histogram Pointer to histogram context
+ */
+void dmgl_histogram_uninitialize(dmgl_histogram_t *histogram);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DMGL_HISTOGRAM_H_ */
@@ -0,0 +1,96 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file page.h
+ * @brief Common copy-on-write pages.
+ */
+
+#ifndef DMGL_PAGE_H_
+#define DMGL_PAGE_H_
+
+#include <buffer.h>
+
+#define DMGL_PAGE_LENGTH 256            /*!< Page length, in bytes, matching the bus page granularity */
+
+/*!
+ * @struct dmgl_page_t
+ * @brief Reference-counted page, shared between forked instances until first write.
+ */
+typedef struct {
+    atomic_uint reference;              /*!< Page reference count */
+    dmgl_buffer_arena_t *arena;         /*!< Page arena, NULL if allocated alone */
+    uint8_t data[DMGL_PAGE_LENGTH];     /*!< Page data */
+} dmgl_page_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Allocate page, filled with value.
+ * @param[out] page Pointer to page pointer
+ * @param[in] value Fill value
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_page_allocate(dmgl_page_t **page, uint8_t value);
+
+/*!
+ * @brief Allocate pages contiguously from one arena, each filled with value.
+ * @param[out] page Pointer to page pointer array
+ * @param[in] count Page count
+ * @param[in] value Fill value
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_page_allocate_arena(dmgl_page_t **page, size_t count, uint8_t value);
+
+/*!
+ * @brief Release page reference, freeing the page with its last reference.
+ * @param[in,out] page Pointer to page, may be NULL
+ */
+void dmgl_page_free(dmgl_page_t *page);
+
+/*!
+ * @brief Share page, adding a reference.
+ * @param[in,out] page Pointer to page
+ * @return Pointer to page
+ */
+dmgl_page_t *dmgl_page_share(dmgl_page_t *page);
+
+/*!
+ * @brief Query page shared status.
+ * @param[in] page Constant pointer to page
+ * @return true if shared, false otherwise
+ */
+bool dmgl_page_shared(const dmgl_page_t *page);
+
+/*!
+ * @brief Query writable page data, duplicating a shared page first.
+ * @param[in,out] page Pointer to page pointer, replaced by its duplicate if shared
+ * @return Pointer to writable page data on success, NULL otherwise
+ */
+uint8_t *dmgl_page_write(dmgl_page_t **page);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DMGL_PAGE_H_ */
@@ -0,0 +1,56 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file pixel.h
+ * @brief Common pixel kernels.
+ */
+
+#ifndef DMGL_PIXEL_H_
+#define DMGL_PIXEL_H_
+
+#include <define.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Decode 2bpp planar tile data into color indices.
+ * @param[in] data Constant pointer to tile data (16 bytes, low/high byte per row)
+ * @param[out] index Pointer to tile color indices (64 bytes, row-major)
+ */
+void dmgl_pixel_decode(const uint8_t *data, uint8_t *index);
+
+/*!
+ * @brief Expand colors into pixels through a palette.
+ * @param[in] color Constant pointer to colors [0-3], masked to their low two bits
+ * @param[in] palette Constant pointer to palette (4 entries)
+ * @param[out] pixel Pointer to pixels
+ * @param[in] length Color/pixel length
+ */
+void dmgl_pixel_expand(const uint8_t *color, const uint32_t *palette, uint32_t *pixel, size_t length);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DMGL_PIXEL_H_ */
@@ -0,0 +1,115 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file rewind.h
+ * @brief Common rewind history.
+ */
+
+#ifndef DMGL_REWIND_H_
+#define DMGL_REWIND_H_
+
+#include <define.h>
+
+/*!
+ * @struct dmgl_rewind_entry_t
+ * @brief Rewind entry, describing one encoded state in the ring.
+ */
+typedef struct {
+    size_t offset;              /*!< Entry offset into ring, in bytes */
+    size_t length;              /*!< Entry length, in bytes */
+    bool keyframe;              /*!< Entry keyframe flag, delta against zero state if set, against keyframe otherwise */
+} dmgl_rewind_entry_t;
+
+/*!
+ * @struct dmgl_rewind_t
+ * @brief Rewind context.
+ */
+typedef struct {
+    size_t length;                  /*!< State length, in bytes */
+    uint32_t interval;              /*!< Keyframe interval, in entries */
+    uint32_t since;                 /*!< Entries since latest keyframe */
+    uint8_t *keyframe;              /*!< Latest keyframe state */
+    uint8_t *scratch;               /*!< Scratch buffer, for encoding */
+    uint8_t *zero;                  /*!< Zero state, keyframe reference */
+
+    struct {
+        uint8_t *data;              /*!< Ring data */
+        size_t capacity;            /*!< Ring capacity, in bytes */
+        size_t head;                /*!< Ring write offset, in bytes */
+    } ring;                         /*!< Rewind ring */
+
+    struct {
+        dmgl_rewind_entry_t *data;  /*!< Entry data */
+        uint32_t capacity;          /*!< Entry capacity */
+        uint32_t count;             /*!< Entry count */
+        uint32_t first;             /*!< Oldest entry index */
+    } entry;                        /*!< Rewind entries */
+} dmgl_rewind_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Query rewind entry count.
+ * @param[in] rewind Constant pointer to rewind context
+ * @return Rewind entry count
+ */
+uint32_t dmgl_rewind_count(const dmgl_rewind_t *rewind);
+
+/*!
+ * @brief Initialize rewind context.
+ * @param[in,out] rewind Pointer to rewind context
+ * @param[in] length State length, in bytes
+ * @param[in] count Maximum entry count
+ * @param[in] interval Keyframe interval, in entries
+ * @param[in] capacity Ring capacity, in bytes
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_rewind_initialize(dmgl_rewind_t *rewind, size_t length, uint32_t count, uint32_t interval, size_t capacity);
+
+/*!
+ * @brief Pop newest state from rewind ring.
+ * @param[in,out] rewind Pointer to rewind context
+ * @param[out] data Pointer to state data
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_rewind_pop(dmgl_rewind_t *rewind, uint8_t *data);
+
+/*!
+ * @brief Push state into rewind ring, evicting oldest states as needed.
+ * @param[in,out] rewind Pointer to rewind context
+ * @param[in] data Constant pointer to state data
+ */
+void dmgl_rewind_push(dmgl_rewind_t *rewind, const uint8_t *data);
+
+/*!
+ * @brief Uninitialize rewind context.
+ * @param[in,out] rewind Pointer to rewind context
+ */
+void dmgl_rewind_uninitialize(dmgl_rewind_t *rewind);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DMGL_REWIND_H_ */
@@ -27,6 +27,8 @@
 #ifndef DMGL_H_
 #define DMGL_H_
 
+#include <stddef.h>
+
 /*!
  * @enum dmgl_error_e
  * @brief DMGL error types.
@@ -34,7 +36,7 @@
 typedef enum {
     DMGL_FAILURE = -1,  /*!< Failure, query dmgl_error for details */
     DMGL_SUCCESS,       /*!< Success */
-    DMGL_COMPLETE,      /*!< Internal type */
+    DMGL_COMPLETE,      /*!< Complete, instance exit requested */
     DMGL_MAX,           /*!< Max error type */
 } dmgl_error_e;
 
@@ -54,11 +56,82 @@ typedef struct {
         int length;     /*!< Cartridge data length, in bytes */
     } cartridge;        /*!< Cartridge context */
 
+    struct {
+        int limit;      /*!< Frame limit, 0 to run until exit is requested */
+    } frame;            /*!< Frame context */
+
+    struct {
+        void *data;     /*!< Input data, one button mask per frame (A, B, Start, Select, Right, Left, Up, Down from bit 0) */
+        int length;     /*!< Input data length, in frames */
+    } input;            /*!< Input context, replayed before live input */
+
+    struct {
+        void *data;     /*!< Movie data to replay from the starting state, NULL to disable */
+        int length;     /*!< Movie data length, in bytes */
+        int record;     /*!< Movie record flag, record button state each frame from the starting state */
+    } movie;            /*!< Movie context */
+
+    struct {
+        int length;     /*!< Rewind history length, in seconds, 0 to disable */
+    } rewind;           /*!< Rewind context */
+
+    struct {
+        int interval;   /*!< Hot-PC sample interval, in cycles, 0 to disable */
+    } sample;           /*!< Sample context */
+
+    struct {
+        int multiplier; /*!< Speed multiplier [1x-16x], 0 for default (1x) */
+        int uncapped;   /*!< Uncapped speed flag, run as fast as the host allows */
+    } speed;            /*!< Speed context */
+
     struct {
         int scale;      /*!< Window scale [1x-8x] */
     } window;           /*!< Window context */
 } dmgl_t;
 
+/*!
+ * @struct dmgl_batch_t
+ * @brief DMGL batch handle (opaque), owning a pool of worker threads reused across batch runs.
+ */
+typedef struct dmgl_batch_s dmgl_batch_t;
+
+/*!
+ * @struct dmgl_hotspot_t
+ * @brief DMGL instance hot-PC sample context.
+ */
+typedef struct {
+    unsigned bank;          /*!< ROM bank, 0 outside switchable ROM */
+    unsigned address;       /*!< Instruction address */
+    unsigned long count;    /*!< Sample count */
+    double ratio;           /*!< Sample ratio, of all samples taken */
+} dmgl_hotspot_t;
+
+/*!
+ * @struct dmgl_instance_t
+ * @brief DMGL instance handle (opaque).
+ */
+typedef struct dmgl_instance_s dmgl_instance_t;
+
+/*!
+ * @struct dmgl_profile_t
+ * @brief DMGL instance opcode profile context, indexed by table (0: base, 1: CB-extended) and opcode.
+ */
+typedef struct {
+    unsigned long count[2][256];    /*!< Opcode executions */
+    unsigned long cycle[2][256];    /*!< Opcode machine cycles */
+} dmgl_profile_t;
+
+/*!
+ * @struct dmgl_statistics_t
+ * @brief DMGL instance statistics context.
+ */
+typedef struct {
+    unsigned long frames;   /*!< Frames completed */
+    double elapsed;         /*!< Host time elapsed, in seconds */
+    double rate;            /*!< Achieved frame rate, in frames per second */
+    double frequency;       /*!< Achieved emulated clock frequency, in MHz */
+} dmgl_statistics_t;
+
 /*!
  * @struct dmgl_version_t
  * @brief DMGL version context.
@@ -81,11 +154,167 @@ extern "C" {
 dmgl_error_e dmgl(const dmgl_t *context);
 
 /*!
- * @brief Query DMGL error string.
+ * @brief Create DMGL batch, starting its worker threads.
+ * @param[out] batch Pointer to DMGL batch handle, NULL on failure
+ * @param[in] workers Worker count, including the calling thread
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_batch_create(dmgl_batch_t **batch, unsigned workers);
+
+/*!
+ * @brief Destroy DMGL batch, stopping its worker threads.
+ * @param[in,out] batch Pointer to DMGL batch handle
+ */
+void dmgl_batch_destroy(dmgl_batch_t *batch);
+
+/*!
+ * @brief Run DMGL instances for a number of frames each, spread across the batch worker threads.
+ * @note Each instance runs on one worker at a time, until its frames are done or it completes or fails. Instances must not share a
+ *       service that is not thread-safe (use the headless service). Runs on the same batch must not overlap.
+ * @param[in,out] batch Pointer to DMGL batch handle
+ * @param[in,out] instance Pointer to array of DMGL instance handles
+ * @param[in] count DMGL instance count
+ * @param[in] frames Frames to run per instance
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise (query dmgl_instance_error on the failed instance for details)
+ */
+dmgl_error_e dmgl_batch_run(dmgl_batch_t *batch, dmgl_instance_t **instance, size_t count, unsigned frames);
+
+/*!
+ * @brief Query DMGL error string, for the calling thread.
  * @return Constant pointer to DMGL error string
  */
 const char *dmgl_error(void);
 
+/*!
+ * @brief Run DMGL instances for a number of frames each, spread across worker threads.
+ * @note Each instance runs on one worker at a time, until its frames are done or it completes or fails. Instances must not share a
+ *       service that is not thread-safe (use the headless service). Worker threads are started and stopped on every call, use
+ *       dmgl_batch_create and dmgl_batch_run to reuse them across calls.
+ * @param[in,out] instance Pointer to array of DMGL instance handles
+ * @param[in] count DMGL instance count
+ * @param[in] frames Frames to run per instance
+ * @param[in] workers Worker count, including the calling thread
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise (query dmgl_instance_error on the failed instance for details)
+ */
+dmgl_error_e dmgl_instance_batch(dmgl_instance_t **instance, size_t count, unsigned frames, unsigned workers);
+
+/*!
+ * @brief Create DMGL instance with context.
+ * @param[out] instance Pointer to DMGL instance handle, NULL on failure
+ * @param[in] context Constant pointer to DMGL context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_instance_create(dmgl_instance_t **instance, const dmgl_t *context);
+
+/*!
+ * @brief Destroy DMGL instance.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ */
+void dmgl_instance_destroy(dmgl_instance_t *instance);
+
+/*!
+ * @brief Query DMGL instance error string.
+ * @param[in] instance Constant pointer to DMGL instance handle
+ * @return Constant pointer to DMGL instance error string
+ */
+const char *dmgl_instance_error(const dmgl_instance_t *instance);
+
+/*!
+ * @brief Fork DMGL instance, sharing ROM and copy-on-write RAM pages with parent.
+ * @param[out] instance Pointer to DMGL instance handle, NULL on failure
+ * @param[in,out] parent Pointer to parent DMGL instance handle
+ * @param[in] context Constant pointer to DMGL context, for service, frame limit and rewind (cartridge and bootloader are ignored)
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_instance_fork(dmgl_instance_t **instance, dmgl_instance_t *parent, const dmgl_t *context);
+
+/*!
+ * @brief Run DMGL instance for a single frame.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @return DMGL_SUCCESS or DMGL_COMPLETE on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_instance_frame(dmgl_instance_t *instance);
+
+/*!
+ * @brief Query DMGL instance hot-PC samples, sorted by descending sample count, available only when sampling is enabled.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[out] hotspot Pointer to DMGL instance hot-PC sample context array
+ * @param[in,out] count Pointer to hot-PC sample count, array length on entry, samples written on return
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_instance_hotspot(dmgl_instance_t *instance, dmgl_hotspot_t *hotspot, size_t *count);
+
+/*!
+ * @brief Query DMGL instance opcode profile, available only when built with PROFILE.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[out] profile Pointer to DMGL instance opcode profile context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_instance_profile(dmgl_instance_t *instance, dmgl_profile_t *profile);
+
+/*!
+ * @brief Query DMGL instance statistics.
+ * @param[in] instance Constant pointer to DMGL instance handle
+ * @param[out] statistics Pointer to DMGL instance statistics context
+ */
+void dmgl_instance_statistics(const dmgl_instance_t *instance, dmgl_statistics_t *statistics);
+
+/*!
+ * @brief Run DMGL instance until exit is requested.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_instance_run(dmgl_instance_t *instance);
+
+/*!
+ * @brief Query DMGL instance recorded movie length.
+ * @param[in] instance Constant pointer to DMGL instance handle
+ * @return Movie length, in bytes, 0 if not recording
+ */
+size_t dmgl_movie_length(const dmgl_instance_t *instance);
+
+/*!
+ * @brief Save DMGL instance recorded movie, with its starting state hash and one button mask per frame.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[out] data Pointer to movie data
+ * @param[in] length Movie data length, in bytes
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_movie_save(dmgl_instance_t *instance, void *data, size_t length);
+
+/*!
+ * @brief Query DMGL instance state length.
+ * @param[in] instance Constant pointer to DMGL instance handle
+ * @return State length, in bytes
+ */
+size_t dmgl_state_length(const dmgl_instance_t *instance);
+
+/*!
+ * @brief Load DMGL instance state from caller-provided buffer.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[in] data Constant pointer to state buffer
+ * @param[in] length State buffer length, in bytes
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_state_load(dmgl_instance_t *instance, const void *data, size_t length);
+
+/*!
+ * @brief Rewind DMGL instance to an earlier frame, from its rewind history.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[in] frames Frames to rewind, clamped to the oldest frame in history
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_state_rewind(dmgl_instance_t *instance, int frames);
+
+/*!
+ * @brief Save DMGL instance state into caller-provided buffer.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[out] data Pointer to state buffer
+ * @param[in] length State buffer length, in bytes
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_state_save(dmgl_instance_t *instance, void *data, size_t length);
+
 /*!
  * @brief Query DMGL version.
  * @return Constant pointer to DMGL version
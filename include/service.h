@@ -27,7 +27,7 @@
 #ifndef DMGL_SERVICE_H_
 #define DMGL_SERVICE_H_
 
-#include <common.h>
+#include <bus.h>
 
 /*!
  * @enum dmgl_button_e
@@ -57,49 +57,60 @@ typedef enum {
     DMGL_COLOR_MAX,         /*!< Max color type */
 } dmgl_color_e;
 
+/*!
+ * @struct dmgl_service_t
+ * @brief Service context (opaque).
+ */
+typedef struct dmgl_service_s dmgl_service_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
 /*!
  * @brief Query service interface button state.
+ * @param[in] service Constant pointer to service context
  * @param[in] button Button type
  * @return Button state (true=pressed, false=released)
  */
-bool dmgl_service_button(dmgl_button_e button);
+bool dmgl_service_button(const dmgl_service_t *service, dmgl_button_e button);
+
+/*!
+ * @brief Hand frame to service interface, without copying.
+ * @param[in,out] service Pointer to service context
+ * @param[in] color Constant pointer to 160x144 pixel colors, row-major, valid until the next frame
+ */
+void dmgl_service_frame(dmgl_service_t *service, const uint8_t *color);
 
 /*!
  * @brief Initialize service interface.
+ * @param[in,out] service Pointer to service context pointer, allocated by this call
  * @param[in] context Constant pointer to DMGL context
+ * @param[in,out] bus Pointer to bus context
  * @param[in] title Constant pointer to service title string
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
-dmgl_error_e dmgl_service_initialize(const dmgl_t *context, const char *title);
-
-/*!
- * @brief Set service interface pixel.
- * @param[in] color Pixel color
- * @param[in] x Pixel x-coordinate
- * @param[in] y Pixel y-coordinate
- */
-void dmgl_service_pixel(dmgl_color_e color, uint8_t x, uint8_t y);
+dmgl_error_e dmgl_service_initialize(dmgl_service_t **service, const dmgl_t *context, dmgl_bus_t *bus, const char *title);
 
 /*!
  * @brief Poll service interface.
+ * @param[in,out] service Pointer to service context
  * @return DMGL_SUCCESS or DMGL_COMPLETE on success, DMGL_FAILURE otherwise
  */
-dmgl_error_e dmgl_service_poll(void);
+dmgl_error_e dmgl_service_poll(dmgl_service_t *service);
 
 /*!
  * @brief Sync service interface.
+ * @param[in,out] service Pointer to service context
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
-dmgl_error_e dmgl_service_sync(void);
+dmgl_error_e dmgl_service_sync(dmgl_service_t *service);
 
 /*!
  * @brief Uninitialize service interface.
+ * @param[in,out] service Pointer to service context, freed by this call
  */
-void dmgl_service_uninitialize(void);
+void dmgl_service_uninitialize(dmgl_service_t *service);
 
 #ifdef __cplusplus
 }
@@ -64,6 +64,14 @@ bool dmgl_bootloader_enabled(const dmgl_bootloader_t *bootloader);
  */
 dmgl_error_e dmgl_bootloader_initialize(dmgl_bootloader_t *bootloader, const uint8_t *data, size_t length);
 
+/*!
+ * @brief Map byte address to bootloader subsystem data.
+ * @param[in] bootloader Constant pointer to bootloader subsystem context
+ * @param[in] address Byte address
+ * @return Constant pointer to byte on success, NULL if unmapped
+ */
+const uint8_t *dmgl_bootloader_map(const dmgl_bootloader_t *bootloader, uint16_t address);
+
 /*!
  * @brief Read byte from bootloader subsystem.
  * @param[in] bootloader Constant pointer to bootloader subsystem context
@@ -67,8 +67,9 @@ typedef struct {
 typedef struct {
 
     struct {
-        uint8_t **bank;         /*!< Cartridge RAM banks */
+        dmgl_page_t **page;     /*!< Cartridge RAM pages, shared copy-on-write between forks */
         size_t count;           /*!< Cartridge RAM bank count */
+        bool fault;             /*!< Cartridge RAM fault flag, set if a write could not duplicate a shared page */
     } ram;                      /*!< Cartridge RAM */
 
     struct {
@@ -88,6 +89,21 @@ extern "C" {
  */
 uint8_t dmgl_cartridge_checksum(const dmgl_cartridge_t *cartridge);
 
+/*!
+ * @brief Query cartridge RAM fault.
+ * @param[in] cartridge Constant pointer to cartridge subsystem context
+ * @return true if a RAM write was dropped, false otherwise
+ */
+bool dmgl_cartridge_fault(const dmgl_cartridge_t *cartridge);
+
+/*!
+ * @brief Fork cartridge subsystem, sharing ROM and copy-on-write RAM pages with parent.
+ * @param[in,out] cartridge Pointer to cartridge subsystem context
+ * @param[in] parent Constant pointer to parent cartridge subsystem context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_cartridge_fork(dmgl_cartridge_t *cartridge, const dmgl_cartridge_t *parent);
+
 /*!
  * @brief Initialize cartridge subsystem.
  * @param[in,out] cartridge Pointer to cartridge subsystem context
@@ -97,6 +113,14 @@ uint8_t dmgl_cartridge_checksum(const dmgl_cartridge_t *cartridge);
  */
 dmgl_error_e dmgl_cartridge_initialize(dmgl_cartridge_t *cartridge, const uint8_t *data, size_t length);
 
+/*!
+ * @brief Load cartridge subsystem state.
+ * @param[in,out] cartridge Pointer to cartridge subsystem context
+ * @param[in] data Constant pointer to state data
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_cartridge_load(dmgl_cartridge_t *cartridge, const uint8_t *data);
+
 /*!
  * @brief Query cartridge RAM bank count.
  * @param[in] cartridge Constant pointer to cartridge subsystem context
@@ -104,6 +128,24 @@ dmgl_error_e dmgl_cartridge_initialize(dmgl_cartridge_t *cartridge, const uint8_
  */
 size_t dmgl_cartridge_ram_count(const dmgl_cartridge_t *cartridge);
 
+/*!
+ * @brief Map byte address to cartridge subsystem RAM bank readable data.
+ * @param[in] cartridge Constant pointer to cartridge subsystem context
+ * @param[in] index RAM bank index
+ * @param[in] address Byte address
+ * @return Constant pointer to byte
+ */
+const uint8_t *dmgl_cartridge_ram_map_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address);
+
+/*!
+ * @brief Map byte address to cartridge subsystem RAM bank writable data.
+ * @param[in] cartridge Pointer to cartridge subsystem context
+ * @param[in] index RAM bank index
+ * @param[in] address Byte address
+ * @return Pointer to byte, NULL if the page is shared (first write duplicates it)
+ */
+uint8_t *dmgl_cartridge_ram_map_write(dmgl_cartridge_t *cartridge, size_t index, uint16_t address);
+
 /*!
  * @brief Read byte from cartridge subsystem RAM bank.
  * @param[in] cartridge Constant pointer to cartridge subsystem context
@@ -125,8 +167,9 @@ void dmgl_cartridge_ram_write(dmgl_cartridge_t *cartridge, size_t index, uint16_
 /*!
  * @brief Reset cartridge subsystem.
  * @param[in,out] cartridge Pointer to cartridge subsystem context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
-void dmgl_cartridge_reset(dmgl_cartridge_t *cartridge);
+dmgl_error_e dmgl_cartridge_reset(dmgl_cartridge_t *cartridge);
 
 /*!
  * @brief Query cartridge ROM bank count.
@@ -135,6 +178,15 @@ void dmgl_cartridge_reset(dmgl_cartridge_t *cartridge);
  */
 size_t dmgl_cartridge_rom_count(const dmgl_cartridge_t *cartridge);
 
+/*!
+ * @brief Map byte address to cartridge subsystem ROM bank data.
+ * @param[in] cartridge Constant pointer to cartridge subsystem context
+ * @param[in] index ROM bank index
+ * @param[in] address Byte address
+ * @return Constant pointer to byte
+ */
+const uint8_t *dmgl_cartridge_rom_map(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address);
+
 /*!
  * @brief Read byte from cartridge subsystem ROM bank.
  * @param[in] cartridge Constant pointer to cartridge subsystem context
@@ -144,6 +196,14 @@ size_t dmgl_cartridge_rom_count(const dmgl_cartridge_t *cartridge);
  */
 uint8_t dmgl_cartridge_rom_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address);
 
+/*!
+ * @brief Save cartridge subsystem state.
+ * @param[in] cartridge Constant pointer to cartridge subsystem context
+ * @param[out] data Pointer to state data, NULL to query length only
+ * @return State length, in bytes
+ */
+size_t dmgl_cartridge_save(const dmgl_cartridge_t *cartridge, uint8_t *data);
+
 /*!
  * @brief Query cartridge title string.
  * @param[in] cartridge Constant pointer to cartridge subsystem context
@@ -34,11 +34,15 @@
  * @brief Mapper subsystem handlers.
  */
 typedef struct {
-    dmgl_error_e (*initialize)(const dmgl_cartridge_t *, void **);  /*!< Mapper initialize handler */
-    uint8_t (*read)(const dmgl_cartridge_t *, void *, uint16_t);    /*!< Mapper read handler */
-    void (*reset)(void *);                                          /*!< Mapper reset handler */
-    void (*uninitialize)(void *);                                   /*!< Mapper uninitialize handler */
-    void (*write)(dmgl_cartridge_t *, void *, uint16_t, uint8_t);   /*!< Mapper write handler */
+    uint16_t (*bank)(const void *, uint16_t);                                /*!< Mapper ROM bank handler */
+    dmgl_error_e (*fork)(const void *, void **);                             /*!< Mapper fork handler */
+    dmgl_error_e (*initialize)(const dmgl_cartridge_t *, void **);           /*!< Mapper initialize handler */
+    const uint8_t *(*map_read)(const dmgl_cartridge_t *, void *, uint16_t);  /*!< Mapper readable map handler */
+    uint8_t *(*map_write)(dmgl_cartridge_t *, void *, uint16_t);             /*!< Mapper writable map handler */
+    uint8_t (*read)(const dmgl_cartridge_t *, void *, uint16_t);             /*!< Mapper read handler */
+    void (*reset)(void *);                                                   /*!< Mapper reset handler */
+    void (*uninitialize)(void *);                                            /*!< Mapper uninitialize handler */
+    bool (*write)(dmgl_cartridge_t *, void *, uint16_t, uint8_t);            /*!< Mapper write handler, true if the bank mapping changed */
 } dmgl_mapper_handler_t;
 
 /*!
@@ -46,15 +50,23 @@ typedef struct {
  * @brief Mapper subsystem context.
  */
 typedef struct {
-    dmgl_cartridge_t cartridge;                                     /*!< Cartridge subsystem context */
-    dmgl_mapper_handler_t handler;                                  /*!< Mapper handlers */
-    void *context;                                                  /*!< Mapper context */
+    dmgl_cartridge_t cartridge;                                              /*!< Cartridge subsystem context */
+    dmgl_mapper_handler_t handler;                                           /*!< Mapper handlers */
+    void *context;                                                           /*!< Mapper context */
 } dmgl_mapper_t;
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+/*!
+ * @brief Query mapper ROM bank mapped at byte address.
+ * @param[in] mapper Constant pointer to mapper subsystem context
+ * @param[in] address Byte address
+ * @return ROM bank index, 0 if address is outside switchable ROM
+ */
+uint16_t dmgl_mapper_bank(const dmgl_mapper_t *mapper, uint16_t address);
+
 /*!
  * @brief Query mapper checksum.
  * @param[in] mapper Constant pointer to mapper subsystem context
@@ -62,6 +74,21 @@ extern "C" {
  */
 uint8_t dmgl_mapper_checksum(const dmgl_mapper_t *mapper);
 
+/*!
+ * @brief Query mapper RAM fault.
+ * @param[in] mapper Constant pointer to mapper subsystem context
+ * @return true if a RAM write was dropped, false otherwise
+ */
+bool dmgl_mapper_fault(const dmgl_mapper_t *mapper);
+
+/*!
+ * @brief Fork mapper subsystem, sharing cartridge ROM and copy-on-write RAM pages with parent.
+ * @param[in,out] mapper Pointer to mapper subsystem context
+ * @param[in] parent Constant pointer to parent mapper subsystem context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_mapper_fork(dmgl_mapper_t *mapper, const dmgl_mapper_t *parent);
+
 /*!
  * @brief Initialize mapper subsystem.
  * @param[in,out] mapper Pointer to mapper subsystem context
@@ -71,6 +98,30 @@ uint8_t dmgl_mapper_checksum(const dmgl_mapper_t *mapper);
  */
 dmgl_error_e dmgl_mapper_initialize(dmgl_mapper_t *mapper, const uint8_t *data, size_t length);
 
+/*!
+ * @brief Load mapper subsystem state.
+ * @param[in,out] mapper Pointer to mapper subsystem context
+ * @param[in] data Constant pointer to state data
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_mapper_load(dmgl_mapper_t *mapper, const uint8_t *data);
+
+/*!
+ * @brief Map byte address to mapper subsystem readable data.
+ * @param[in] mapper Constant pointer to mapper subsystem context
+ * @param[in] address Byte address
+ * @return Constant pointer to byte on success, NULL if unmapped
+ */
+const uint8_t *dmgl_mapper_map_read(const dmgl_mapper_t *mapper, uint16_t address);
+
+/*!
+ * @brief Map byte address to mapper subsystem writable data.
+ * @param[in,out] mapper Pointer to mapper subsystem context
+ * @param[in] address Byte address
+ * @return Pointer to byte on success, NULL if unmapped
+ */
+uint8_t *dmgl_mapper_map_write(dmgl_mapper_t *mapper, uint16_t address);
+
 /*!
  * @brief Read byte from mapper subsystem.
  * @param[in] mapper Constant pointer to mapper subsystem context
@@ -82,8 +133,17 @@ uint8_t dmgl_mapper_read(const dmgl_mapper_t *mapper, uint16_t address);
 /*!
  * @brief Reset mapper subsystem.
  * @param[in,out] mapper Pointer to mapper subsystem context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_mapper_reset(dmgl_mapper_t *mapper);
+
+/*!
+ * @brief Save mapper subsystem state.
+ * @param[in] mapper Constant pointer to mapper subsystem context
+ * @param[out] data Pointer to state data, NULL to query length only
+ * @return State length, in bytes
  */
-void dmgl_mapper_reset(dmgl_mapper_t *mapper);
+size_t dmgl_mapper_save(const dmgl_mapper_t *mapper, uint8_t *data);
 
 /*!
  * @brief Query mapper title string.
@@ -103,8 +163,9 @@ void dmgl_mapper_uninitialize(dmgl_mapper_t *mapper);
  * @param[in,out] mapper Pointer to mapper subsystem context
  * @param[in] address Byte address
  * @param[in] value Byte value
+ * @return true if the ROM bank or RAM enable mapping changed, false otherwise
  */
-void dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value);
+bool dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value);
 
 #ifdef __cplusplus
 }
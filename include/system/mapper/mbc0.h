@@ -33,6 +33,22 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*!
+ * @brief Query MBC0 mapper subsystem ROM bank mapped at byte address.
+ * @param[in] context Constant pointer to context
+ * @param[in] address Byte address
+ * @return ROM bank index, 0 if address is outside switchable ROM
+ */
+uint16_t dmgl_mbc0_bank(const void *context, uint16_t address);
+
+/*!
+ * @brief Fork MBC0 mapper subsystem context.
+ * @param[in] context Constant pointer to parent context
+ * @param[out] fork Pointer to forked context pointer
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_mbc0_fork(const void *context, void **fork);
+
 /*!
  * @brief Initialize MBC0 mapper subsystem.
  * @param[in] cartridge Pointer to cartridge subsystem context
@@ -41,6 +57,24 @@ extern "C" {
  */
 dmgl_error_e dmgl_mbc0_initialize(const dmgl_cartridge_t *cartridge, void **context);
 
+/*!
+ * @brief Map byte address to MBC0 mapper subsystem readable data.
+ * @param[in] cartridge Constant pointer to cartridge subsystem context
+ * @param[in,out] context Pointer to context
+ * @param[in] address Byte address
+ * @return Constant pointer to byte on success, NULL if unmapped
+ */
+const uint8_t *dmgl_mbc0_map_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address);
+
+/*!
+ * @brief Map byte address to MBC0 mapper subsystem writable data.
+ * @param[in,out] cartridge Pointer to cartridge subsystem context
+ * @param[in,out] context Pointer to context
+ * @param[in] address Byte address
+ * @return Pointer to byte on success, NULL if unmapped
+ */
+uint8_t *dmgl_mbc0_map_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address);
+
 /*!
  * @brief Read byte from MBC0 mapper subsystem.
  * @param[in] cartridge Constant pointer to cartridge subsystem context
@@ -68,8 +102,9 @@ void dmgl_mbc0_uninitialize(void *context);
  * @param[in,out] context Pointer to context
  * @param[in] address Byte address
  * @param[in] value Byte value
+ * @return true if the bank mapping changed, false otherwise (MBC0 has no banking)
  */
-void dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value);
+bool dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value);
 
 #ifdef __cplusplus
 }
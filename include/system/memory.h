@@ -38,15 +38,34 @@ typedef struct {
     dmgl_bootloader_t bootloader;   /*!< Bootloader subsystem context */
     dmgl_mapper_t mapper;           /*!< Mapper subsystem context */
     uint8_t high[0x7F];             /*!< High RAM [FF80-FFFE] */
-    uint8_t internal[0x2000];       /*!< Internal RAM [C000-DFFF], Mirrored [E000-FDFF] */
+    dmgl_page_t *internal[0x20];    /*!< Internal RAM pages [C000-DFFF], Mirrored [E000-FDFF] */
     uint8_t sprite[0xA0];           /*!< Sprite RAM [FE00-FE9F] */
-    uint8_t video[0x2000];          /*!< Video RAM [8000-9FFF] */
+    dmgl_page_t *video[0x20];       /*!< Video RAM pages [8000-9FFF] */
+    bool fault;                     /*!< Memory fault flag, set if a write could not duplicate a shared page */
+
+    struct {
+        uint8_t index[384][64];     /*!< Decoded tile color indices [8000-97FF], 8x8 row-major per tile */
+        bool dirty[384];            /*!< Tile dirty flags, set by writes to tile data */
+    } tile;                         /*!< Memory tile cache */
+
+    struct {
+        const uint8_t *read[256];   /*!< Readable page pointers, NULL if handled by subsystem */
+        uint8_t *write[256];        /*!< Writable page pointers, NULL if handled by subsystem */
+    } page;                         /*!< Memory page table, indexed by address high byte */
 } dmgl_memory_t;
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+/*!
+ * @brief Query memory ROM bank mapped at byte address.
+ * @param[in] memory Constant pointer to memory subsystem context
+ * @param[in] address Byte address
+ * @return ROM bank index, 0 if address is outside switchable ROM
+ */
+uint16_t dmgl_memory_bank(const dmgl_memory_t *memory, uint16_t address);
+
 /*!
  * @brief Query memory checksum.
  * @param[in] memory Constant pointer to memory subsystem context
@@ -54,6 +73,21 @@ extern "C" {
  */
 uint8_t dmgl_memory_checksum(const dmgl_memory_t *memory);
 
+/*!
+ * @brief Query memory fault.
+ * @param[in] memory Constant pointer to memory subsystem context
+ * @return true if a RAM write was dropped, false otherwise
+ */
+bool dmgl_memory_fault(const dmgl_memory_t *memory);
+
+/*!
+ * @brief Fork memory subsystem, sharing RAM pages copy-on-write with parent.
+ * @param[in,out] memory Pointer to memory subsystem context
+ * @param[in,out] parent Pointer to parent memory subsystem context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_memory_fork(dmgl_memory_t *memory, dmgl_memory_t *parent);
+
 /*!
  * @brief Query memory bootloader status.
  * @param[in] memory Constant pointer to memory subsystem context
@@ -69,6 +103,14 @@ bool dmgl_memory_has_bootloader(const dmgl_memory_t *memory);
  */
 dmgl_error_e dmgl_memory_initialize(dmgl_memory_t *memory, const dmgl_t *context);
 
+/*!
+ * @brief Load memory subsystem state.
+ * @param[in,out] memory Pointer to memory subsystem context
+ * @param[in] data Constant pointer to state data
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_memory_load(dmgl_memory_t *memory, const uint8_t *data);
+
 /*!
  * @brief Read byte from memory subsystem.
  * @param[in] memory Constant pointer to memory subsystem context
@@ -80,8 +122,25 @@ uint8_t dmgl_memory_read(const dmgl_memory_t *memory, uint16_t address);
 /*!
  * @brief Reset memory subsystem.
  * @param[in,out] memory Pointer to memory subsystem context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_memory_reset(dmgl_memory_t *memory);
+
+/*!
+ * @brief Save memory subsystem state.
+ * @param[in] memory Constant pointer to memory subsystem context
+ * @param[out] data Pointer to state data, NULL to query length only
+ * @return State length, in bytes
+ */
+size_t dmgl_memory_save(const dmgl_memory_t *memory, uint8_t *data);
+
+/*!
+ * @brief Query decoded memory tile, decoding it first if dirty.
+ * @param[in,out] memory Pointer to memory subsystem context
+ * @param[in] tile Tile index [0-383]
+ * @return Constant pointer to 8x8 tile color indices, row-major
  */
-void dmgl_memory_reset(dmgl_memory_t *memory);
+const uint8_t *dmgl_memory_tile(dmgl_memory_t *memory, uint16_t tile);
 
 /*!
  * @brief Query memory title string.
@@ -27,7 +27,18 @@
 #ifndef DMGL_PROCESSOR_H_
 #define DMGL_PROCESSOR_H_
 
-#include <common.h>
+#include <bus.h>
+
+#define DMGL_PROCESSOR_BLOCK_COUNT 1024     /*!< Processor block cache entries */
+#define DMGL_PROCESSOR_BLOCK_LENGTH 32      /*!< Processor block length, in instructions */
+#define DMGL_PROCESSOR_JIT_LENGTH 0x40000   /*!< Processor JIT code buffer length, in bytes */
+#define DMGL_PROCESSOR_LANES 16             /*!< Processor lockstep lanes, per structure-of-arrays group */
+
+/*!
+ * @struct dmgl_processor_block_t
+ * @brief Processor subsystem pre-decoded block (opaque).
+ */
+typedef struct dmgl_processor_block_s dmgl_processor_block_t;
 
 /*!
  * @struct dmgl_processor_interrupt_t
@@ -79,9 +90,21 @@ typedef union {
  * @brief Processor subsystem context.
  */
 typedef struct {
-    uint8_t cycle;                          /*!< Processor cycle counter */
+    dmgl_bus_t *bus;                        /*!< Processor bus context */
     uint8_t checksum;                       /*!< Processor cartridge checksum */
     bool has_bootloader;                    /*!< Processor bootloader flag */
+#if PROFILE
+    dmgl_profile_t profile;                 /*!< Processor opcode profile */
+#endif /* PROFILE */
+    dmgl_processor_block_t *block;          /*!< Processor block cache, keyed by ROM bank and address, allocated on first use */
+#if JIT
+
+    struct {
+        uint8_t *code;                      /*!< Processor JIT code buffer, mapped on first use */
+        size_t length;                      /*!< Processor JIT code length, in bytes */
+        bool disabled;                      /*!< Processor JIT disabled flag, set if the code buffer can not be mapped or protected */
+    } jit;                                  /*!< Processor x86-64 JIT */
+#endif /* JIT */
 
     struct {
         dmgl_processor_register_t af;       /*!< Processor AF register */
@@ -125,19 +148,35 @@ extern "C" {
 #endif /* __cplusplus */
 
 /*!
- * @brief Clock processor subsystem.
+ * @brief Clock processor subsystem by one machine cycle (4 clock cycles).
  * @param[in,out] processor Pointer to processor subsystem context
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
 dmgl_error_e dmgl_processor_clock(dmgl_processor_t *processor);
 
+/*!
+ * @brief Fork processor subsystem, rebinding it to bus and dropping the block cache and JIT code copied from its parent.
+ * @param[in,out] processor Pointer to processor subsystem context
+ * @param[in,out] bus Pointer to bus context
+ */
+void dmgl_processor_fork(dmgl_processor_t *processor, dmgl_bus_t *bus);
+
 /*!
  * @brief Initialize processor subsystem.
  * @param[in,out] processor Pointer to processor subsystem context
+ * @param[in,out] bus Pointer to bus context
  * @param[in] has_bootloader Bootloader flag
  * @param[in] checksum Cartridge checksum
  */
-void dmgl_processor_initialize(dmgl_processor_t *processor, bool has_bootloader, uint8_t checksum);
+void dmgl_processor_initialize(dmgl_processor_t *processor, dmgl_bus_t *bus, bool has_bootloader, uint8_t checksum);
+
+/*!
+ * @brief Load processor subsystem state.
+ * @param[in,out] processor Pointer to processor subsystem context
+ * @param[in] data Constant pointer to state data
+ * @return State length, in bytes
+ */
+size_t dmgl_processor_load(dmgl_processor_t *processor, const uint8_t *data);
 
 /*!
  * @brief Read byte from processor subsystem.
@@ -153,6 +192,35 @@ uint8_t dmgl_processor_read(const dmgl_processor_t *processor, uint16_t address)
  */
 void dmgl_processor_reset(dmgl_processor_t *processor);
 
+/*!
+ * @brief Run processor subsystem through cached blocks of whole instructions, falling back to a single machine cycle.
+ * @param[in,out] processor Pointer to processor subsystem context
+ * @param[in] limit Cycle limit, in clock cycles
+ * @param[out] cycle Cycles elapsed, in clock cycles
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_processor_run(dmgl_processor_t *processor, uint64_t limit, uint32_t *cycle);
+
+/*!
+ * @brief Run processor subsystems in lockstep, executing a shared cached block across lanes in structure-of-arrays layout, falling
+ *        back to dmgl_processor_run for lanes that diverge.
+ * @note All processors must be running the same cartridge ROM.
+ * @param[in,out] processor Pointer to array of processor subsystem context pointers
+ * @param[in] count Processor subsystem count
+ * @param[in] limit Constant pointer to array of cycle limits, in clock cycles
+ * @param[out] cycle Pointer to array of cycles elapsed, in clock cycles
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+dmgl_error_e dmgl_processor_run_lanes(dmgl_processor_t **processor, uint32_t count, const uint64_t *limit, uint32_t *cycle);
+
+/*!
+ * @brief Save processor subsystem state.
+ * @param[in] processor Constant pointer to processor subsystem context
+ * @param[out] data Pointer to state data, NULL to query length only
+ * @return State length, in bytes
+ */
+size_t dmgl_processor_save(const dmgl_processor_t *processor, uint8_t *data);
+
 /*!
  * @brief Uninitialize processor subsystem.
  * @param[in,out] processor Pointer to processor subsystem context
@@ -0,0 +1,185 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file video.h
+ * @brief Video subsystem.
+ */
+
+#ifndef DMGL_VIDEO_H_
+#define DMGL_VIDEO_H_
+
+#include <bus.h>
+
+/*!
+ * @enum dmgl_video_mode_e
+ * @brief Video subsystem modes.
+ */
+typedef enum {
+    DMGL_VIDEO_HBLANK = 0,                  /*!< Horizontal-blank mode */
+    DMGL_VIDEO_VBLANK,                      /*!< Vertical-blank mode */
+    DMGL_VIDEO_SEARCH,                      /*!< Object search mode */
+    DMGL_VIDEO_TRANSFER,                    /*!< Pixel transfer mode */
+    DMGL_VIDEO_MAX,                         /*!< Max video mode */
+} dmgl_video_mode_e;
+
+/*!
+ * @struct dmgl_video_control_t
+ * @brief Video subsystem control register.
+ */
+typedef union {
+
+    struct {
+        uint8_t background_enabled : 1;     /*!< Background/window enabled flag */
+        uint8_t object_enabled : 1;         /*!< Object enabled flag */
+        uint8_t object_size : 1;            /*!< Object size (0=8x8, 1=8x16) */
+        uint8_t background_map : 1;         /*!< Background map select (0=9800, 1=9C00) */
+        uint8_t background_data : 1;        /*!< Background/window data select (0=8800, 1=8000) */
+        uint8_t window_enabled : 1;         /*!< Window enabled flag */
+        uint8_t window_map : 1;             /*!< Window map select (0=9800, 1=9C00) */
+        uint8_t enabled : 1;                /*!< Display enabled flag */
+    };
+
+    uint8_t raw;                            /*!< Raw control register */
+} dmgl_video_control_t;
+
+/*!
+ * @struct dmgl_video_status_t
+ * @brief Video subsystem status register.
+ */
+typedef union {
+
+    struct {
+        uint8_t mode : 2;                   /*!< Video mode */
+        uint8_t coincidence : 1;            /*!< Line coincidence flag */
+        uint8_t hblank_interrupt : 1;       /*!< Horizontal-blank interrupt enabled flag */
+        uint8_t vblank_interrupt : 1;       /*!< Vertical-blank interrupt enabled flag */
+        uint8_t search_interrupt : 1;       /*!< Object search interrupt enabled flag */
+        uint8_t coincidence_interrupt : 1;  /*!< Line coincidence interrupt enabled flag */
+        uint8_t : 1;                        /*!< Unused flag */
+    };
+
+    uint8_t raw;                            /*!< Raw status register */
+} dmgl_video_status_t;
+
+/*!
+ * @struct dmgl_video_t
+ * @brief Video subsystem context.
+ */
+typedef struct {
+    dmgl_bus_t *bus;                        /*!< Video bus context */
+    bool has_bootloader;                    /*!< Video bootloader flag */
+    dmgl_video_control_t control;           /*!< Video control register (LCDC) [FF40] */
+    dmgl_video_status_t status;             /*!< Video status register (STAT) [FF41] */
+    uint8_t dma;                            /*!< Video object transfer register (DMA) [FF46] */
+
+    struct {
+        uint8_t y;                          /*!< Video scroll-y register (SCY) [FF42] */
+        uint8_t x;                          /*!< Video scroll-x register (SCX) [FF43] */
+    } scroll;                               /*!< Video scroll */
+
+    struct {
+        uint8_t y;                          /*!< Video line register (LY) [FF44] */
+        uint8_t coincidence;                /*!< Video line coincidence register (LYC) [FF45] */
+    } line;                                 /*!< Video line */
+
+    struct {
+        uint8_t background;                 /*!< Video background palette register (BGP) [FF47] */
+        uint8_t object[2];                  /*!< Video object palette registers (OBP0/OBP1) [FF48-FF49] */
+    } palette;                              /*!< Video palette */
+
+    struct {
+        uint8_t y;                          /*!< Video window-y register (WY) [FF4A] */
+        uint8_t x;                          /*!< Video window-x register (WX) [FF4B] */
+        uint8_t line;                       /*!< Video window line counter */
+    } window;                               /*!< Video window */
+
+    uint8_t pixel[144][160];                /*!< Video pixel buffer, in colors (not part of saved state) */
+} dmgl_video_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Service video subsystem event, advancing to the next mode.
+ * @param[in,out] video Pointer to video subsystem context
+ * @return Cycles until the next video event, 0 if the display is disabled
+ */
+uint32_t dmgl_video_event(dmgl_video_t *video);
+
+/*!
+ * @brief Initialize video subsystem.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[in,out] bus Pointer to bus context
+ * @param[in] has_bootloader Bootloader flag
+ */
+void dmgl_video_initialize(dmgl_video_t *video, dmgl_bus_t *bus, bool has_bootloader);
+
+/*!
+ * @brief Load video subsystem state.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[in] data Constant pointer to state data
+ * @return State length, in bytes
+ */
+size_t dmgl_video_load(dmgl_video_t *video, const uint8_t *data);
+
+/*!
+ * @brief Read byte from video subsystem.
+ * @param[in] video Constant pointer to video subsystem context
+ * @param[in] address Byte address
+ * @return Byte value
+ */
+uint8_t dmgl_video_read(const dmgl_video_t *video, uint16_t address);
+
+/*!
+ * @brief Reset video subsystem.
+ * @param[in,out] video Pointer to video subsystem context
+ */
+void dmgl_video_reset(dmgl_video_t *video);
+
+/*!
+ * @brief Save video subsystem state.
+ * @param[in] video Constant pointer to video subsystem context
+ * @param[out] data Pointer to state data, NULL to query length only
+ * @return State length, in bytes
+ */
+size_t dmgl_video_save(const dmgl_video_t *video, uint8_t *data);
+
+/*!
+ * @brief Uninitialize video subsystem.
+ * @param[in,out] video Pointer to video subsystem context
+ */
+void dmgl_video_uninitialize(dmgl_video_t *video);
+
+/*!
+ * @brief Write byte to video subsystem.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[in] address Byte address
+ * @param[in] value Byte value
+ */
+void dmgl_video_write(dmgl_video_t *video, uint16_t address, uint8_t value);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DMGL_VIDEO_H_ */
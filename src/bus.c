@@ -27,123 +27,415 @@
 #include <bus.h>
 #include <memory.h>
 #include <processor.h>
+#include <video.h>
 
 /*!
- * @struct dmgl_bus_t
+ * @struct dmgl_bus_s
  * @brief Bus context.
  */
-typedef struct {
-    dmgl_memory_t memory;       /*!< Memory context */
-    dmgl_processor_t processor; /*!< Processor context */
+struct dmgl_bus_s {
+    dmgl_memory_t memory;                   /*!< Memory context */
+    dmgl_processor_t processor;             /*!< Processor context */
+    dmgl_video_t video;                     /*!< Video context */
 
     /* TODO: ADD SUBSYSTEMS */
-    uint32_t cycle;             /*!< Bus cycle counter */
-    /* ---- */
 
-} dmgl_bus_t;
+    struct {
+        uint64_t deadline[DMGL_EVENT_MAX];  /*!< Event deadlines, in cycles */
+        uint64_t next;                      /*!< Nearest event deadline, in cycles */
+    } event;                                /*!< Bus events */
 
-static dmgl_bus_t g_bus = {};   /*!< Error context */
+    uint64_t cycle;                         /*!< Bus cycle counter */
+
+    struct {
+        dmgl_histogram_t histogram;         /*!< Sample histogram, keyed by ROM bank and instruction address */
+        uint64_t deadline;                  /*!< Next sample deadline, in cycles, UINT64_MAX if disabled */
+        uint32_t interval;                  /*!< Sample interval, in cycles */
+    } sample;                               /*!< Bus hot-PC sampler, excluded from state */
+};
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
-dmgl_error_e dmgl_bus_clock(void)
+/*!
+ * @brief Update nearest bus event deadline.
+ * @param[in,out] bus Pointer to bus context
+ */
+static void dmgl_bus_deadline(dmgl_bus_t *bus)
+{
+    bus->event.next = UINT64_MAX;
+
+    for(dmgl_event_e event = 0; event < DMGL_EVENT_MAX; ++event) {
+
+        if(bus->event.deadline[event] < bus->event.next) {
+            bus->event.next = bus->event.deadline[event];
+        }
+    }
+}
+
+/*!
+ * @brief Service bus event.
+ * @param[in,out] bus Pointer to bus context
+ * @param[in] event Event type
+ * @return DMGL_SUCCESS or DMGL_COMPLETE on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bus_event(dmgl_bus_t *bus, dmgl_event_e event)
+{
+    uint32_t delay = 0;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    switch(event) {
+        case DMGL_EVENT_FRAME:
+            delay = DMGL_BUS_FRAME;
+            result = DMGL_COMPLETE;
+            break;
+        case DMGL_EVENT_VIDEO:
+            delay = dmgl_video_event(&bus->video);
+            break;
+
+        /* TODO: SERVICE SUBSYSTEM EVENTS */
+
+        default:
+            break;
+    }
+
+    bus->event.deadline[event] = delay ? (bus->event.deadline[event] + delay) : UINT64_MAX;
+
+    return result;
+}
+
+uint32_t dmgl_bus_block(const dmgl_bus_t *bus, uint16_t address)
+{
+    uint32_t result = UINT32_MAX;
+
+    switch(address) {
+        case 0x0000 ... 0x00FF:
+
+            if(!dmgl_memory_has_bootloader(&bus->memory)) {
+                result = (dmgl_memory_bank(&bus->memory, address) << 16) | address;
+            }
+            break;
+        case 0x0100 ... 0x7FFF:
+            result = (dmgl_memory_bank(&bus->memory, address) << 16) | address;
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+dmgl_error_e dmgl_bus_clock(dmgl_bus_t *bus)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    uint64_t next = (bus->sample.deadline < bus->event.next) ? bus->sample.deadline : bus->event.next;
+
+    while(bus->cycle < next) {
+        uint32_t cycle;
+
+        if((result = dmgl_processor_run(&bus->processor, next - bus->cycle, &cycle)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        bus->cycle += cycle;
+    }
+
+    if(dmgl_memory_fault(&bus->memory)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    while(bus->sample.deadline <= bus->cycle) {
+        uint16_t address = bus->processor.instruction.address.word;
+
+        if((result = dmgl_histogram_increment(&bus->sample.histogram, (dmgl_memory_bank(&bus->memory, address) << 16) | address)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        bus->sample.deadline += bus->sample.interval;
+    }
+
+    for(dmgl_event_e event = 0; event < DMGL_EVENT_MAX; ++event) {
+
+        while(bus->event.deadline[event] <= bus->cycle) {
+
+            switch(dmgl_bus_event(bus, event)) {
+                case DMGL_FAILURE:
+                    result = DMGL_FAILURE;
+                    goto exit;
+                case DMGL_COMPLETE:
+                    result = DMGL_COMPLETE;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    dmgl_bus_deadline(bus);
+
+exit:
+    return result;
+}
+
+uint64_t dmgl_bus_cycle(const dmgl_bus_t *bus)
+{
+    return bus->cycle;
+}
+
+const uint8_t *dmgl_bus_frame(const dmgl_bus_t *bus)
+{
+    return &bus->video.pixel[0][0];
+}
+
+dmgl_error_e dmgl_bus_fork(dmgl_bus_t **bus, dmgl_bus_t *parent)
 {
     dmgl_error_e result;
 
-    if((result = dmgl_processor_clock(&g_bus.processor)) != DMGL_SUCCESS) {
+    if(!(*bus = dmgl_buffer_allocate(sizeof(**bus)))) {
+        result = DMGL_ERROR("Bus allocation failed -- %.02f KB (%zu bytes)", sizeof(**bus) / 1024.f, sizeof(**bus));
         goto exit;
     }
 
-    /* TODO: CLOCK SUBSYSTEMS */
-    if(++g_bus.cycle > 4194304 / 60) {
-        result = DMGL_COMPLETE;
-        g_bus.cycle = 0;
+    memcpy(*bus, parent, sizeof(**bus));
+    memset(&(*bus)->sample, 0, sizeof((*bus)->sample));
+    (*bus)->sample.deadline = UINT64_MAX;
+    dmgl_processor_fork(&(*bus)->processor, *bus);
+
+    if((result = dmgl_memory_fork(&(*bus)->memory, &parent->memory)) != DMGL_SUCCESS) {
+        goto exit;
     }
-    /* ---- */
+
+    (*bus)->video.bus = *bus;
+
+    /* TODO: FORK SUBSYSTEMS */
 
 exit:
     return result;
 }
 
-dmgl_error_e dmgl_bus_initialize(const dmgl_t *context)
+const dmgl_histogram_t *dmgl_bus_histogram(const dmgl_bus_t *bus)
+{
+    return bus->sample.interval ? &bus->sample.histogram : NULL;
+}
+
+dmgl_error_e dmgl_bus_initialize(dmgl_bus_t **bus, const dmgl_t *context)
 {
     dmgl_error_e result;
 
-    if((result = dmgl_memory_initialize(&g_bus.memory, context)) != DMGL_SUCCESS) {
+    if(!(*bus = dmgl_buffer_allocate(sizeof(**bus)))) {
+        result = DMGL_ERROR("Bus allocation failed -- %.02f KB (%zu bytes)", sizeof(**bus) / 1024.f, sizeof(**bus));
         goto exit;
     }
 
-    dmgl_processor_initialize(&g_bus.processor, dmgl_memory_has_bootloader(&g_bus.memory), dmgl_memory_checksum(&g_bus.memory));
+    if((result = dmgl_memory_initialize(&(*bus)->memory, context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    dmgl_processor_initialize(&(*bus)->processor, *bus, dmgl_memory_has_bootloader(&(*bus)->memory), dmgl_memory_checksum(&(*bus)->memory));
+
+    dmgl_video_initialize(&(*bus)->video, *bus, dmgl_memory_has_bootloader(&(*bus)->memory));
 
     /* TODO: INITIALIZE SUBSYSTEMS */
 
+    for(dmgl_event_e event = 0; event < DMGL_EVENT_MAX; ++event) {
+        (*bus)->event.deadline[event] = UINT64_MAX;
+    }
+
+    (*bus)->sample.deadline = UINT64_MAX;
+
+    dmgl_bus_schedule(*bus, DMGL_EVENT_FRAME, DMGL_BUS_FRAME);
+    dmgl_bus_schedule(*bus, DMGL_EVENT_VIDEO, 80);
+
+exit:
+    return result;
+}
+
+void dmgl_bus_interrupt(dmgl_bus_t *bus, dmgl_interrupt_e interrupt)
+{
+    dmgl_bus_write(bus, 0xFF0F, dmgl_bus_read(bus, 0xFF0F) | (1 << interrupt));
+}
+
+dmgl_error_e dmgl_bus_load(dmgl_bus_t *bus, const uint8_t *data)
+{
+    dmgl_error_e result;
+    size_t length = dmgl_memory_save(&bus->memory, NULL);
+
+    memcpy(&bus->event, data, sizeof(bus->event));
+    data += sizeof(bus->event);
+    memcpy(&bus->cycle, data, sizeof(bus->cycle));
+    data += sizeof(bus->cycle);
+
+    if((result = dmgl_memory_load(&bus->memory, data)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    data += length;
+    data += dmgl_processor_load(&bus->processor, data);
+    data += dmgl_video_load(&bus->video, data);
+
+    /* TODO: LOAD SUBSYSTEMS */
+
+    if(bus->sample.interval) {
+        bus->sample.deadline = bus->cycle + bus->sample.interval;
+    }
+
 exit:
     return result;
 }
 
-void dmgl_bus_interrupt(dmgl_interrupt_e interrupt)
+#if PROFILE
+
+void dmgl_bus_profile(const dmgl_bus_t *bus, dmgl_profile_t *profile)
 {
-    dmgl_bus_write(0xFF0F, dmgl_bus_read(0xFF0F) | (1 << interrupt));
+    memcpy(profile, &bus->processor.profile, sizeof(*profile));
 }
+#endif /* PROFILE */
 
-uint8_t dmgl_bus_read(uint16_t address)
+uint8_t dmgl_bus_read(const dmgl_bus_t *bus, uint16_t address)
 {
     uint8_t result = 0xFF;
+    const uint8_t *page;
 
-    switch(address) {
+    if((page = bus->memory.page.read[address >> 8])) {
+        result = page[address & 0xFF];
+    } else {
 
-        /* TODO: READ BYTE FROM SUBSYSTEMS */
+        switch(address) {
 
-        case 0xFF0F:
-        case 0xFFFF:
-            result = dmgl_processor_read(&g_bus.processor, address);
-            break;
-        default:
-            result = dmgl_memory_read(&g_bus.memory, address);
-            break;
+            /* TODO: READ BYTE FROM SUBSYSTEMS */
+
+            case 0xFF40 ... 0xFF4B:
+                result = dmgl_video_read(&bus->video, address);
+                break;
+
+            case 0xFF0F:
+            case 0xFFFF:
+                result = dmgl_processor_read(&bus->processor, address);
+                break;
+            default:
+                result = dmgl_memory_read(&bus->memory, address);
+                break;
+        }
     }
 
     return result;
 }
 
-void dmgl_bus_reset(void)
+dmgl_error_e dmgl_bus_reset(dmgl_bus_t *bus)
 {
-    dmgl_memory_reset(&g_bus.memory);
-    dmgl_processor_reset(&g_bus.processor);
+    dmgl_error_e result;
+
+    if((result = dmgl_memory_reset(&bus->memory)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    dmgl_processor_reset(&bus->processor);
+    dmgl_video_reset(&bus->video);
 
     /* TODO: RESET SUBSYSTEMS */
+
+    dmgl_bus_schedule(bus, DMGL_EVENT_FRAME, DMGL_BUS_FRAME);
+    dmgl_bus_schedule(bus, DMGL_EVENT_VIDEO, 80);
+
+exit:
+    return result;
 }
 
-const char *dmgl_bus_title(void)
+size_t dmgl_bus_save(const dmgl_bus_t *bus, uint8_t *data)
 {
-    return dmgl_memory_title(&g_bus.memory);
+    size_t result = sizeof(bus->event) + sizeof(bus->cycle);
+
+    if(data) {
+        memcpy(data, &bus->event, sizeof(bus->event));
+        memcpy(data + sizeof(bus->event), &bus->cycle, sizeof(bus->cycle));
+    }
+
+    result += dmgl_memory_save(&bus->memory, data ? (data + result) : NULL);
+    result += dmgl_processor_save(&bus->processor, data ? (data + result) : NULL);
+    result += dmgl_video_save(&bus->video, data ? (data + result) : NULL);
+
+    /* TODO: SAVE SUBSYSTEMS */
+
+    return result;
 }
 
-void dmgl_bus_uninitialize(void)
+dmgl_error_e dmgl_bus_sample(dmgl_bus_t *bus, uint32_t interval)
 {
-    /* TODO: UNINITIALIZE SUBSYSTEMS */
+    dmgl_error_e result;
 
-    dmgl_processor_uninitialize(&g_bus.processor);
-    dmgl_memory_uninitialize(&g_bus.memory);
-    memset(&g_bus, 0, sizeof(g_bus));
+    if(!interval) {
+        result = DMGL_ERROR("Invalid sample interval -- %u cycles", interval);
+        goto exit;
+    }
+
+    if((result = dmgl_histogram_initialize(&bus->sample.histogram, DMGL_BUS_SAMPLE)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    bus->sample.interval = interval;
+    bus->sample.deadline = bus->cycle + interval;
+
+exit:
+    return result;
 }
 
-void dmgl_bus_write(uint16_t address, uint8_t value)
+void dmgl_bus_schedule(dmgl_bus_t *bus, dmgl_event_e event, uint32_t delay)
 {
+    bus->event.deadline[event] = bus->cycle + delay;
+    dmgl_bus_deadline(bus);
+}
 
-    switch(address) {
+const uint8_t *dmgl_bus_tile(dmgl_bus_t *bus, uint16_t tile)
+{
+    return dmgl_memory_tile(&bus->memory, tile);
+}
 
-        /* TODO: WRITE BYTE TO SUBSYSTEMS */
+const char *dmgl_bus_title(const dmgl_bus_t *bus)
+{
+    return dmgl_memory_title(&bus->memory);
+}
 
-        case 0xFF0F:
-        case 0xFFFF:
-            dmgl_processor_write(&g_bus.processor, address, value);
-            break;
-        default:
-            dmgl_memory_write(&g_bus.memory, address, value);
-            break;
+void dmgl_bus_uninitialize(dmgl_bus_t *bus)
+{
+
+    if(bus) {
+
+        /* TODO: UNINITIALIZE SUBSYSTEMS */
+
+        dmgl_histogram_uninitialize(&bus->sample.histogram);
+        dmgl_video_uninitialize(&bus->video);
+        dmgl_processor_uninitialize(&bus->processor);
+        dmgl_memory_uninitialize(&bus->memory);
+        dmgl_buffer_free(bus);
+    }
+}
+
+void dmgl_bus_write(dmgl_bus_t *bus, uint16_t address, uint8_t value)
+{
+    uint8_t *page;
+
+    if((page = bus->memory.page.write[address >> 8])) {
+        page[address & 0xFF] = value;
+    } else {
+
+        switch(address) {
+
+            /* TODO: WRITE BYTE TO SUBSYSTEMS */
+
+            case 0xFF40 ... 0xFF4B:
+                dmgl_video_write(&bus->video, address, value);
+                break;
+
+            case 0xFF0F:
+            case 0xFFFF:
+                dmgl_processor_write(&bus->processor, address, value);
+                break;
+            default:
+                dmgl_memory_write(&bus->memory, address, value);
+                break;
+        }
     }
 }
 
@@ -35,6 +35,40 @@ void *dmgl_buffer_allocate(size_t length)
     return calloc(length, sizeof(uint8_t));
 }
 
+dmgl_buffer_arena_t *dmgl_buffer_arena_allocate(size_t length)
+{
+    dmgl_buffer_arena_t *result;
+
+    if((result = dmgl_buffer_allocate(sizeof(*result) + length))) {
+        atomic_init(&result->reference, 1);
+        result->length = length;
+    }
+
+    return result;
+}
+
+void *dmgl_buffer_arena_claim(dmgl_buffer_arena_t *arena, size_t length)
+{
+    void *result = NULL;
+    size_t offset = (arena->offset + (_Alignof(max_align_t) - 1)) & ~(_Alignof(max_align_t) - 1);
+
+    if((offset <= arena->length) && (length <= (arena->length - offset))) {
+        atomic_fetch_add_explicit(&arena->reference, 1, memory_order_relaxed);
+        arena->offset = offset + length;
+        result = &arena->data[offset];
+    }
+
+    return result;
+}
+
+void dmgl_buffer_arena_release(dmgl_buffer_arena_t *arena)
+{
+
+    if(atomic_fetch_sub_explicit(&arena->reference, 1, memory_order_acq_rel) == 1) {
+        dmgl_buffer_free(arena);
+    }
+}
+
 void dmgl_buffer_free(void *buffer)
 {
     free(buffer);
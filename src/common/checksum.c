@@ -41,6 +41,17 @@ uint8_t dmgl_checksum(const void *data, size_t begin, size_t end)
     return result & 0xFF;
 }
 
+uint64_t dmgl_hash(const void *data, size_t length)
+{
+    uint64_t result = 0xCBF29CE484222325;
+
+    for(size_t index = 0; index < length; ++index) {
+        result = (result ^ ((const uint8_t *)data)[index]) * 0x00000100000001B3;
+    }
+
+    return result;
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -34,7 +34,7 @@ typedef struct {
     char message[256];              /*!< Error message string */
 } dmgl_error_t;
 
-static dmgl_error_t g_error = {};   /*!< Error context */
+static _Thread_local dmgl_error_t g_error = {};   /*!< Error context, per-thread */
 
 #ifdef __cplusplus
 extern "C" {
@@ -0,0 +1,167 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file histogram.c
+ * @brief Common sample histogram.
+ */
+
+#include <common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Find histogram entry for key, or the unused entry where it belongs.
+ * @param[in] entry Pointer to entry table
+ * @param[in] capacity Entry table capacity, power of two
+ * @param[in] key Entry key
+ * @return Pointer to entry
+ */
+static dmgl_histogram_entry_t *dmgl_histogram_find(dmgl_histogram_entry_t *entry, size_t capacity, uint32_t key)
+{
+    size_t index = (key * 0x9E3779B1U) & (capacity - 1);
+
+    while(entry[index].count && (entry[index].key != key)) {
+        index = (index + 1) & (capacity - 1);
+    }
+
+    return &entry[index];
+}
+
+/*!
+ * @brief Double histogram entry table capacity, rehashing used entries.
+ * @param[in,out] histogram Pointer to histogram context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_histogram_grow(dmgl_histogram_t *histogram)
+{
+    dmgl_histogram_entry_t *entry;
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t capacity = 2 * histogram->capacity;
+
+    if(!(entry = dmgl_buffer_allocate(capacity * sizeof(*entry)))) {
+        result = DMGL_ERROR("Histogram allocation failed -- %.02f KB (%zu bytes)", (capacity * sizeof(*entry)) / 1024.f, capacity * sizeof(*entry));
+        goto exit;
+    }
+
+    for(size_t index = 0; index < histogram->capacity; ++index) {
+
+        if(histogram->entry[index].count) {
+            *dmgl_histogram_find(entry, capacity, histogram->entry[index].key) = histogram->entry[index];
+        }
+    }
+
+    dmgl_buffer_free(histogram->entry);
+    histogram->entry = entry;
+    histogram->capacity = capacity;
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_histogram_increment(dmgl_histogram_t *histogram, uint32_t key)
+{
+    dmgl_histogram_entry_t *entry;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(entry = dmgl_histogram_find(histogram->entry, histogram->capacity, key))->count) {
+
+        if((2 * (histogram->length + 1)) > histogram->capacity) {
+
+            if((result = dmgl_histogram_grow(histogram)) != DMGL_SUCCESS) {
+                goto exit;
+            }
+
+            entry = dmgl_histogram_find(histogram->entry, histogram->capacity, key);
+        }
+
+        entry->key = key;
+        ++histogram->length;
+    }
+
+    ++entry->count;
+    ++histogram->total;
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_histogram_initialize(dmgl_histogram_t *histogram, size_t capacity)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!capacity || (capacity & (capacity - 1))) {
+        result = DMGL_ERROR("Invalid histogram capacity -- %zu entries", capacity);
+        goto exit;
+    }
+
+    if(!(histogram->entry = dmgl_buffer_allocate(capacity * sizeof(*histogram->entry)))) {
+        result = DMGL_ERROR("Histogram allocation failed -- %.02f KB (%zu bytes)", (capacity * sizeof(*histogram->entry)) / 1024.f, capacity * sizeof(*histogram->entry));
+        goto exit;
+    }
+
+    histogram->capacity = capacity;
+
+exit:
+    return result;
+}
+
+size_t dmgl_histogram_top(const dmgl_histogram_t *histogram, dmgl_histogram_entry_t *entry, size_t count)
+{
+    size_t result = 0;
+
+    for(size_t index = 0; index < histogram->capacity; ++index) {
+        size_t position;
+
+        if(!histogram->entry[index].count) {
+            continue;
+        }
+
+        for(position = result; (position > 0) && (entry[position - 1].count < histogram->entry[index].count); --position) {
+
+            if(position < count) {
+                entry[position] = entry[position - 1];
+            }
+        }
+
+        if(position < count) {
+            entry[position] = histogram->entry[index];
+
+            if(result < count) {
+                ++result;
+            }
+        }
+    }
+
+    return result;
+}
+
+void dmgl_histogram_uninitialize(dmgl_histogram_t *histogram)
+{
+    dmgl_buffer_free(histogram->entry);
+    memset(histogram, 0, sizeof(*histogram));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,124 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file page.c
+ * @brief Common copy-on-write pages.
+ */
+
+#include <common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+dmgl_error_e dmgl_page_allocate(dmgl_page_t **page, uint8_t value)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(*page = dmgl_buffer_allocate(sizeof(**page)))) {
+        result = DMGL_ERROR("Page allocation failed -- %zu bytes", sizeof(**page));
+        goto exit;
+    }
+
+    atomic_init(&(*page)->reference, 1);
+    memset((*page)->data, value, sizeof((*page)->data));
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_page_allocate_arena(dmgl_page_t **page, size_t count, uint8_t value)
+{
+    dmgl_buffer_arena_t *arena;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(arena = dmgl_buffer_arena_allocate(count * sizeof(**page)))) {
+        result = DMGL_ERROR("Page arena allocation failed -- %zu bytes", count * sizeof(**page));
+        goto exit;
+    }
+
+    for(size_t index = 0; index < count; ++index) {
+        page[index] = dmgl_buffer_arena_claim(arena, sizeof(**page));
+        atomic_init(&page[index]->reference, 1);
+        page[index]->arena = arena;
+        memset(page[index]->data, value, sizeof(page[index]->data));
+    }
+
+    dmgl_buffer_arena_release(arena);
+
+exit:
+    return result;
+}
+
+void dmgl_page_free(dmgl_page_t *page)
+{
+
+    if(page && (atomic_fetch_sub_explicit(&page->reference, 1, memory_order_acq_rel) == 1)) {
+
+        if(page->arena) {
+            dmgl_buffer_arena_release(page->arena);
+        } else {
+            dmgl_buffer_free(page);
+        }
+    }
+}
+
+dmgl_page_t *dmgl_page_share(dmgl_page_t *page)
+{
+    atomic_fetch_add_explicit(&page->reference, 1, memory_order_relaxed);
+
+    return page;
+}
+
+bool dmgl_page_shared(const dmgl_page_t *page)
+{
+    return atomic_load_explicit(&((dmgl_page_t *)page)->reference, memory_order_acquire) > 1;
+}
+
+uint8_t *dmgl_page_write(dmgl_page_t **page)
+{
+    dmgl_page_t *copy;
+    uint8_t *result = NULL;
+
+    if(dmgl_page_shared(*page)) {
+
+        if(!(copy = dmgl_buffer_allocate(sizeof(*copy)))) {
+            DMGL_ERROR("Page allocation failed -- %zu bytes", sizeof(*copy));
+            goto exit;
+        }
+
+        atomic_init(&copy->reference, 1);
+        copy->arena = NULL;
+        memcpy(copy->data, (*page)->data, sizeof(copy->data));
+        dmgl_page_free(*page);
+        *page = copy;
+    }
+
+    result = (*page)->data;
+
+exit:
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,118 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file pixel.c
+ * @brief Common pixel kernels.
+ */
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif /* __AVX2__ || __SSE2__ */
+#include <common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+/*!
+ * @brief Broadcast byte to each byte of a quad-word.
+ * @param[in] value Byte value
+ * @return Quad-word value
+ */
+static inline int64_t dmgl_pixel_broadcast(uint8_t value)
+{
+    return value * 0x0101010101010101ULL;
+}
+#endif /* __AVX2__ || __SSE2__ */
+
+void dmgl_pixel_decode(const uint8_t *data, uint8_t *index)
+{
+#if defined(__AVX2__)
+    const __m256i mask = _mm256_set1_epi64x(0x0102040810204080LL);
+
+    for(uint8_t row = 0; row < 8; row += 4, data += 8, index += 32) {
+        __m256i low = _mm256_set_epi64x(dmgl_pixel_broadcast(data[6]), dmgl_pixel_broadcast(data[4]), dmgl_pixel_broadcast(data[2]), dmgl_pixel_broadcast(data[0]));
+        __m256i high = _mm256_set_epi64x(dmgl_pixel_broadcast(data[7]), dmgl_pixel_broadcast(data[5]), dmgl_pixel_broadcast(data[3]), dmgl_pixel_broadcast(data[1]));
+
+        low = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(low, mask), mask), _mm256_set1_epi8(1));
+        high = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(high, mask), mask), _mm256_set1_epi8(2));
+        _mm256_storeu_si256((__m256i *)index, _mm256_or_si256(low, high));
+    }
+#elif defined(__SSE2__)
+    const __m128i mask = _mm_set1_epi64x(0x0102040810204080LL);
+
+    for(uint8_t row = 0; row < 8; row += 2, data += 4, index += 16) {
+        __m128i low = _mm_set_epi64x(dmgl_pixel_broadcast(data[2]), dmgl_pixel_broadcast(data[0]));
+        __m128i high = _mm_set_epi64x(dmgl_pixel_broadcast(data[3]), dmgl_pixel_broadcast(data[1]));
+
+        low = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(low, mask), mask), _mm_set1_epi8(1));
+        high = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(high, mask), mask), _mm_set1_epi8(2));
+        _mm_storeu_si128((__m128i *)index, _mm_or_si128(low, high));
+    }
+#else
+    for(uint8_t row = 0; row < 8; ++row, data += 2) {
+
+        for(uint8_t x = 0; x < 8; ++x) {
+            *(index++) = (((data[1] >> (7 - x)) & 1) << 1) | ((data[0] >> (7 - x)) & 1);
+        }
+    }
+#endif /* __AVX2__ */
+}
+
+void dmgl_pixel_expand(const uint8_t *color, const uint32_t *palette, uint32_t *pixel, size_t length)
+{
+    size_t index = 0;
+#if defined(__AVX2__)
+    const __m256i mask = _mm256_set1_epi32(3), table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)palette));
+
+    for(; (index + 8) <= length; index += 8) {
+        __m256i value = _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&color[index])), mask);
+
+        _mm256_storeu_si256((__m256i *)&pixel[index], _mm256_permutevar8x32_epi32(table, value));
+    }
+#elif defined(__SSE2__)
+    const __m128i mask = _mm_set1_epi32(3), table[] = {
+        _mm_set1_epi32(palette[0]), _mm_set1_epi32(palette[1]), _mm_set1_epi32(palette[2]), _mm_set1_epi32(palette[3]),
+        };
+
+    for(; (index + 4) <= length; index += 4) {
+        __m128i result = _mm_setzero_si128(),
+            value = _mm_and_si128(_mm_setr_epi32(color[index], color[index + 1], color[index + 2], color[index + 3]), mask);
+
+        for(int entry = 0; entry < 4; ++entry) {
+            result = _mm_or_si128(result, _mm_and_si128(_mm_cmpeq_epi32(value, _mm_set1_epi32(entry)), table[entry]));
+        }
+
+        _mm_storeu_si128((__m128i *)&pixel[index], result);
+    }
+#endif /* __AVX2__ */
+
+    for(; index < length; ++index) {
+        pixel[index] = palette[color[index] & 3];
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
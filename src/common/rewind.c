@@ -0,0 +1,336 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file rewind.c
+ * @brief Common rewind history.
+ */
+
+#include <common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Read variable-length rewind delta value.
+ * @param[in,out] delta Pointer to delta data pointer, advanced past value
+ * @return Value
+ */
+static size_t dmgl_rewind_value_read(const uint8_t **delta)
+{
+    size_t result = 0;
+
+    for(uint32_t shift = 0;; shift += 7) {
+        uint8_t value = *((*delta)++);
+
+        result |= (size_t)(value & 0x7F) << shift;
+
+        if(!(value & 0x80)) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Write variable-length rewind delta value.
+ * @param[out] delta Pointer to delta data
+ * @param[in] value Value
+ * @return Pointer to delta data, past value
+ */
+static uint8_t *dmgl_rewind_value_write(uint8_t *delta, size_t value)
+{
+
+    for(; value >= 0x80; value >>= 7) {
+        *(delta++) = (value & 0x7F) | 0x80;
+    }
+
+    *(delta++) = value;
+
+    return delta;
+}
+
+/*!
+ * @brief Decode rewind delta, XORing its literal runs into state.
+ * @param[in] delta Constant pointer to delta data
+ * @param[in] length Delta length, in bytes
+ * @param[in,out] data Pointer to state data, holding the reference state
+ */
+static void dmgl_rewind_decode(const uint8_t *delta, size_t length, uint8_t *data)
+{
+    const uint8_t *end = delta + length;
+
+    while(delta < end) {
+        size_t control = dmgl_rewind_value_read(&delta), run = control >> 1;
+
+        if(control & 1) {
+
+            for(size_t index = 0; index < run; ++index) {
+                data[index] ^= delta[index];
+            }
+
+            delta += run;
+        }
+
+        data += run;
+    }
+}
+
+/*!
+ * @brief Count matching bytes between state and reference state.
+ * @param[in] reference Constant pointer to reference state data
+ * @param[in] data Constant pointer to state data
+ * @param[in] length State length, in bytes
+ * @return Matching length, in bytes
+ */
+static size_t dmgl_rewind_match(const uint8_t *reference, const uint8_t *data, size_t length)
+{
+    size_t result = 0;
+
+    for(uint64_t first, second; (result + sizeof(uint64_t)) <= length; result += sizeof(uint64_t)) {
+        memcpy(&first, data + result, sizeof(first));
+        memcpy(&second, reference + result, sizeof(second));
+
+        if(first != second) {
+            break;
+        }
+    }
+
+    while((result < length) && (data[result] == reference[result])) {
+        ++result;
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Encode state as XOR/RLE delta against reference state.
+ * @param[in] reference Constant pointer to reference state data
+ * @param[in] data Constant pointer to state data
+ * @param[in] length State length, in bytes
+ * @param[out] delta Pointer to delta data, at least (2 * length) + 16 bytes
+ * @return Delta length, in bytes
+ */
+static size_t dmgl_rewind_encode(const uint8_t *reference, const uint8_t *data, size_t length, uint8_t *delta)
+{
+    size_t index = 0;
+    uint8_t *begin = delta;
+
+    while(index < length) {
+        size_t first, match = dmgl_rewind_match(reference + index, data + index, length - index);
+
+        if((index += match) == length) {
+            break;
+        }
+
+        if(match) {
+            delta = dmgl_rewind_value_write(delta, match << 1);
+        }
+
+        first = index;
+
+        while(index < length) {
+
+            if(data[index] != reference[index]) {
+                ++index;
+                continue;
+            }
+
+            match = dmgl_rewind_match(reference + index, data + index, (length - index < 4) ? (length - index) : 4);
+
+            if((match == 4) || ((index + match) == length)) {
+                break;
+            }
+
+            index += match;
+        }
+
+        delta = dmgl_rewind_value_write(delta, ((index - first) << 1) | 1);
+
+        for(; first < index; ++first) {
+            *(delta++) = data[first] ^ reference[first];
+        }
+    }
+
+    return delta - begin;
+}
+
+/*!
+ * @brief Evict oldest rewind entry, along with any deltas left without their keyframe.
+ * @param[in,out] rewind Pointer to rewind context
+ */
+static void dmgl_rewind_evict(dmgl_rewind_t *rewind)
+{
+
+    do {
+        rewind->entry.first = (rewind->entry.first + 1) % rewind->entry.capacity;
+        --rewind->entry.count;
+    } while(rewind->entry.count && !rewind->entry.data[rewind->entry.first].keyframe);
+}
+
+/*!
+ * @brief Reserve space at rewind ring head, evicting oldest entries as needed.
+ * @param[in,out] rewind Pointer to rewind context
+ * @param[in] length Reserved length, in bytes
+ */
+static void dmgl_rewind_reserve(dmgl_rewind_t *rewind, size_t length)
+{
+
+    if(rewind->entry.count == rewind->entry.capacity) {
+        dmgl_rewind_evict(rewind);
+    }
+
+    if((rewind->ring.head + length) > rewind->ring.capacity) {
+
+        while(rewind->entry.count && (rewind->entry.data[rewind->entry.first].offset >= rewind->ring.head)) {
+            dmgl_rewind_evict(rewind);
+        }
+
+        rewind->ring.head = 0;
+    }
+
+    while(rewind->entry.count && (rewind->entry.data[rewind->entry.first].offset >= rewind->ring.head)
+            && (rewind->entry.data[rewind->entry.first].offset < (rewind->ring.head + length))) {
+        dmgl_rewind_evict(rewind);
+    }
+}
+
+uint32_t dmgl_rewind_count(const dmgl_rewind_t *rewind)
+{
+    return rewind->entry.count;
+}
+
+dmgl_error_e dmgl_rewind_initialize(dmgl_rewind_t *rewind, size_t length, uint32_t count, uint32_t interval, size_t capacity)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!length || !count || !interval || (capacity < ((2 * length) + 16))) {
+        result = DMGL_ERROR("Invalid rewind configuration -- %zu bytes, %u entries, %u interval, %zu capacity", length, count, interval, capacity);
+        goto exit;
+    }
+
+    rewind->length = length;
+    rewind->interval = interval;
+    rewind->ring.capacity = capacity;
+    rewind->entry.capacity = count;
+
+    if(!(rewind->entry.data = dmgl_buffer_allocate(count * sizeof(*rewind->entry.data)))
+            || !(rewind->ring.data = dmgl_buffer_allocate(capacity))
+            || !(rewind->keyframe = dmgl_buffer_allocate(length))
+            || !(rewind->zero = dmgl_buffer_allocate(length))
+            || !(rewind->scratch = dmgl_buffer_allocate((2 * length) + 16))) {
+        result = DMGL_ERROR("Rewind allocation failed -- %.02f KB (%zu bytes)", capacity / 1024.f, capacity);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_rewind_pop(dmgl_rewind_t *rewind, uint8_t *data)
+{
+    const dmgl_rewind_entry_t *entry;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!rewind->entry.count) {
+        result = DMGL_ERROR("Rewind history empty");
+        goto exit;
+    }
+
+    entry = &rewind->entry.data[(rewind->entry.first + rewind->entry.count - 1) % rewind->entry.capacity];
+
+    if(entry->keyframe) {
+        memset(data, 0, rewind->length);
+    } else {
+        memcpy(data, rewind->keyframe, rewind->length);
+    }
+
+    dmgl_rewind_decode(rewind->ring.data + entry->offset, entry->length, data);
+    rewind->ring.head = entry->offset;
+    --rewind->entry.count;
+
+    if(entry->keyframe) {
+        rewind->since = 0;
+
+        for(uint32_t index = rewind->entry.count; index > 0; --index, ++rewind->since) {
+            const dmgl_rewind_entry_t *previous = &rewind->entry.data[(rewind->entry.first + index - 1) % rewind->entry.capacity];
+
+            if(previous->keyframe) {
+                memset(rewind->keyframe, 0, rewind->length);
+                dmgl_rewind_decode(rewind->ring.data + previous->offset, previous->length, rewind->keyframe);
+                break;
+            }
+        }
+    } else {
+        --rewind->since;
+    }
+
+exit:
+    return result;
+}
+
+void dmgl_rewind_push(dmgl_rewind_t *rewind, const uint8_t *data)
+{
+    size_t length;
+    dmgl_rewind_entry_t *entry;
+    bool keyframe = !rewind->entry.count || (rewind->since >= rewind->interval);
+
+    for(;;) {
+        length = dmgl_rewind_encode(keyframe ? rewind->zero : rewind->keyframe, data, rewind->length, rewind->scratch);
+        dmgl_rewind_reserve(rewind, length);
+
+        if(keyframe || rewind->entry.count) {
+            break;
+        }
+
+        keyframe = true;
+    }
+
+    entry = &rewind->entry.data[(rewind->entry.first + rewind->entry.count++) % rewind->entry.capacity];
+    entry->offset = rewind->ring.head;
+    entry->length = length;
+    entry->keyframe = keyframe;
+    memcpy(rewind->ring.data + rewind->ring.head, rewind->scratch, length);
+    rewind->ring.head += length;
+
+    if(keyframe) {
+        memcpy(rewind->keyframe, data, rewind->length);
+        rewind->since = 0;
+    } else {
+        ++rewind->since;
+    }
+}
+
+void dmgl_rewind_uninitialize(dmgl_rewind_t *rewind)
+{
+    dmgl_buffer_free(rewind->scratch);
+    dmgl_buffer_free(rewind->zero);
+    dmgl_buffer_free(rewind->keyframe);
+    dmgl_buffer_free(rewind->ring.data);
+    dmgl_buffer_free(rewind->entry.data);
+    memset(rewind, 0, sizeof(*rewind));
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
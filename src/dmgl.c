@@ -24,46 +24,838 @@
  * @brief DMGL interface.
  */
 
+#include <stdatomic.h>
+#include <threads.h>
+#include <time.h>
 #include <bus.h>
 #include <service.h>
 
+#define DMGL_BATCH_ALIGN 64            /*!< Batch worker alignment, in bytes (cache line) */
+#define DMGL_MOVIE_CAPACITY 3600        /*!< Movie initial capacity, in frames */
+#define DMGL_MOVIE_MAGIC 0x4D474D44     /*!< Movie magic ("DMGM") */
+#define DMGL_MOVIE_VERSION 1            /*!< Movie layout version */
+#define DMGL_REWIND_INTERVAL 60         /*!< Rewind keyframe interval, in frames */
+#define DMGL_REWIND_RATE 60             /*!< Rewind frames per second of history */
+#define DMGL_STATE_MAGIC 0x4C474D44     /*!< State magic ("DMGL") */
+#define DMGL_STATE_VERSION 1            /*!< State layout version */
+
+/*!
+ * @struct dmgl_batch_worker_t
+ * @brief DMGL batch worker, owning a contiguous range of instances that idle workers may steal from.
+ * @note Workers are cache line aligned, so that claiming from one worker range does not contend with the others.
+ */
+typedef struct {
+    _Alignas(DMGL_BATCH_ALIGN) atomic_size_t next;  /*!< Next unclaimed instance index */
+    size_t end;                                     /*!< Instance range end index (exclusive) */
+    dmgl_batch_t *batch;                            /*!< Batch context */
+    thrd_t thread;                                  /*!< Worker thread */
+    bool started;                                   /*!< Worker thread started flag */
+} dmgl_batch_worker_t;
+
+/*!
+ * @struct dmgl_batch_s
+ * @brief DMGL batch context, shared by all batch workers.
+ */
+struct dmgl_batch_s {
+    mtx_t lock;                     /*!< Batch lock, guarding generation, pending and shutdown */
+    cnd_t start;                    /*!< Batch start condition, signaled when a run begins or the batch shuts down */
+    cnd_t done;                     /*!< Batch done condition, signaled when the last worker thread finishes a run */
+    bool ready;                     /*!< Batch lock and conditions initialized flag */
+    bool shutdown;                  /*!< Batch shutdown flag */
+    uint64_t generation;            /*!< Batch run generation */
+    uint32_t pending;               /*!< Worker threads still running the current generation */
+    uint32_t started;               /*!< Worker threads started */
+    dmgl_instance_t **instance;     /*!< Instance handles */
+    uint32_t frames;                /*!< Frames to run per instance */
+    uint32_t workers;               /*!< Worker count */
+    void *buffer;                   /*!< Worker buffer, as allocated */
+    dmgl_batch_worker_t *worker;    /*!< Workers, one per worker thread, cache line aligned within the worker buffer */
+    atomic_size_t failure;          /*!< First failed instance index, SIZE_MAX if none failed */
+};
+
+/*!
+ * @struct dmgl_movie_header_t
+ * @brief DMGL movie header, followed by one button mask per frame.
+ */
+typedef struct {
+    uint32_t magic;             /*!< Movie magic */
+    uint32_t version;           /*!< Movie layout version */
+    uint64_t hash;              /*!< Movie starting state hash */
+    uint64_t length;            /*!< Movie length, in frames */
+} dmgl_movie_header_t;
+
+/*!
+ * @struct dmgl_state_header_t
+ * @brief DMGL state header, followed by bus state.
+ */
+typedef struct {
+    uint32_t magic;             /*!< State magic */
+    uint32_t version;           /*!< State layout version */
+    uint64_t length;            /*!< State length, in bytes, including header */
+} dmgl_state_header_t;
+
+/*!
+ * @struct dmgl_instance_s
+ * @brief DMGL instance context.
+ */
+struct dmgl_instance_s {
+    dmgl_bus_t *bus;            /*!< Bus context */
+    dmgl_service_t *service;    /*!< Service context */
+    char error[256];            /*!< Error message string */
+
+    struct {
+        uint32_t count;         /*!< Frame counter */
+        uint32_t limit;         /*!< Frame limit, 0 for unlimited */
+        struct timespec begin;  /*!< Frame begin time */
+        struct timespec end;    /*!< Frame end time, for last completed frame */
+    } frame;                    /*!< Instance frames */
+
+    struct {
+        uint8_t *data;          /*!< Movie button masks, NULL if not recording */
+        size_t capacity;        /*!< Movie capacity, in frames */
+        size_t length;          /*!< Movie length, in frames */
+        uint64_t hash;          /*!< Movie starting state hash */
+    } movie;                    /*!< Instance movie */
+
+    struct {
+        dmgl_rewind_t history;  /*!< Rewind history */
+        uint8_t *state;         /*!< Rewind state buffer, NULL if disabled */
+        size_t length;          /*!< Rewind state length, in bytes */
+    } rewind;                   /*!< Instance rewind */
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+/*!
+ * @brief Run DMGL batch worker, claiming instances from its own range first, then stealing from the other workers.
+ * @param[in,out] worker Pointer to DMGL batch worker
+ */
+static void dmgl_batch_work(dmgl_batch_worker_t *worker)
+{
+    dmgl_batch_t *batch = worker->batch;
+    uint32_t id = worker - batch->worker;
+
+    for(uint32_t offset = 0; offset < batch->workers; ++offset) {
+        dmgl_batch_worker_t *victim = &batch->worker[(id + offset) % batch->workers];
+        size_t index;
+
+        while((index = atomic_fetch_add_explicit(&victim->next, 1, memory_order_relaxed)) < victim->end) {
+
+            for(uint32_t frame = 0; frame < batch->frames; ++frame) {
+                dmgl_error_e result = dmgl_instance_frame(batch->instance[index]);
+
+                if(result == DMGL_FAILURE) {
+                    size_t expected = SIZE_MAX;
+
+                    atomic_compare_exchange_strong(&batch->failure, &expected, index);
+                    break;
+                } else if(result == DMGL_COMPLETE) {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * @brief Run DMGL batch worker thread, waiting for each batch run and working on it until the batch shuts down.
+ * @param[in,out] argument Pointer to DMGL batch worker
+ * @return 0 always, failures are reported through the batch context
+ */
+static int dmgl_batch_thread(void *argument)
+{
+    uint64_t generation = 0;
+    dmgl_batch_worker_t *worker = argument;
+    dmgl_batch_t *batch = worker->batch;
+
+    mtx_lock(&batch->lock);
+
+    for(;;) {
+
+        while(!batch->shutdown && (batch->generation == generation)) {
+            cnd_wait(&batch->start, &batch->lock);
+        }
+
+        if(batch->shutdown) {
+            break;
+        }
+
+        generation = batch->generation;
+        mtx_unlock(&batch->lock);
+        dmgl_batch_work(worker);
+        mtx_lock(&batch->lock);
+
+        if(!--batch->pending) {
+            cnd_signal(&batch->done);
+        }
+    }
+
+    mtx_unlock(&batch->lock);
+
+    return 0;
+}
+
+/*!
+ * @brief Hash DMGL instance state, excluding its header.
+ * @param[in] instance Constant pointer to DMGL instance handle
+ * @param[out] hash Pointer to state hash
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_instance_hash(const dmgl_instance_t *instance, uint64_t *hash)
+{
+    uint8_t *data;
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length = dmgl_bus_save(instance->bus, NULL);
+
+    if(!(data = dmgl_buffer_allocate(length))) {
+        result = DMGL_ERROR("State allocation failed -- %.02f KB (%zu bytes)", length / 1024.f, length);
+        goto exit;
+    }
+
+    dmgl_bus_save(instance->bus, data);
+    *hash = dmgl_hash(data, length);
+    dmgl_buffer_free(data);
+
+exit:
+    return result;
+}
+
+/*!
+ * @brief Record DMGL instance button state for the current frame.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_instance_record(dmgl_instance_t *instance)
+{
+    uint8_t mask = 0;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(instance->movie.length == instance->movie.capacity) {
+        uint8_t *data;
+        size_t capacity = 2 * instance->movie.capacity;
+
+        if(!(data = dmgl_buffer_allocate(capacity))) {
+            result = DMGL_ERROR("Movie allocation failed -- %.02f KB (%zu bytes)", capacity / 1024.f, capacity);
+            goto exit;
+        }
+
+        memcpy(data, instance->movie.data, instance->movie.length);
+        dmgl_buffer_free(instance->movie.data);
+        instance->movie.data = data;
+        instance->movie.capacity = capacity;
+    }
+
+    for(dmgl_button_e button = 0; button < DMGL_BUTTON_MAX; ++button) {
+
+        if(dmgl_service_button(instance->service, button)) {
+            mask |= (1 << button);
+        }
+    }
+
+    instance->movie.data[instance->movie.length++] = mask;
+
+exit:
+    return result;
+}
+
+/*!
+ * @brief Setup DMGL instance sampling, movie, service, rewind history and frame timing with context.
+ * @param[in,out] instance Pointer to DMGL instance handle, with bus context
+ * @param[in] context Constant pointer to DMGL context
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_instance_setup(dmgl_instance_t *instance, const dmgl_t *context)
+{
+    dmgl_error_e result;
+    dmgl_t setting = *context;
+    const dmgl_t *service = context;
+
+    if(context->frame.limit > 0) {
+        instance->frame.limit = context->frame.limit;
+    }
+
+    if((context->sample.interval > 0) && ((result = dmgl_bus_sample(instance->bus, context->sample.interval)) != DMGL_SUCCESS)) {
+        goto exit;
+    }
+
+    if(context->movie.data) {
+        uint64_t hash = 0;
+        dmgl_movie_header_t header;
+
+        if((context->movie.length <= 0) || ((size_t)context->movie.length < sizeof(header))) {
+            result = DMGL_ERROR("Movie too small -- %d bytes", context->movie.length);
+            goto exit;
+        }
+
+        memcpy(&header, context->movie.data, sizeof(header));
+
+        if(header.magic != DMGL_MOVIE_MAGIC) {
+            result = DMGL_ERROR("Invalid movie magic -- %08X", header.magic);
+            goto exit;
+        }
+
+        if(header.version != DMGL_MOVIE_VERSION) {
+            result = DMGL_ERROR("Unsupported movie version -- %u", header.version);
+            goto exit;
+        }
+
+        if(header.length != ((size_t)context->movie.length - sizeof(header))) {
+            result = DMGL_ERROR("Invalid movie length -- %zu frames", (size_t)header.length);
+            goto exit;
+        }
+
+        if((result = dmgl_instance_hash(instance, &hash)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        if(hash != header.hash) {
+            result = DMGL_ERROR("Movie starting state mismatch -- %016llX (expecting %016llX)", (unsigned long long)hash, (unsigned long long)header.hash);
+            goto exit;
+        }
+
+        setting.input.data = (uint8_t *)context->movie.data + sizeof(header);
+        setting.input.length = header.length;
+        setting.speed.uncapped = true;
+        service = &setting;
+
+        if(!instance->frame.limit) {
+            instance->frame.limit = instance->frame.count + header.length;
+        }
+    }
+
+    if(context->movie.record) {
+
+        if((result = dmgl_instance_hash(instance, &instance->movie.hash)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        if(!(instance->movie.data = dmgl_buffer_allocate(DMGL_MOVIE_CAPACITY))) {
+            result = DMGL_ERROR("Movie allocation failed -- %.02f KB (%zu bytes)", DMGL_MOVIE_CAPACITY / 1024.f, (size_t)DMGL_MOVIE_CAPACITY);
+            goto exit;
+        }
+
+        instance->movie.capacity = DMGL_MOVIE_CAPACITY;
+    }
+
+    if((result = dmgl_service_initialize(&instance->service, service, instance->bus, dmgl_bus_title(instance->bus))) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if(context->rewind.length > 0) {
+        size_t length = dmgl_state_length(instance);
+        uint32_t count = context->rewind.length * DMGL_REWIND_RATE;
+
+        if((result = dmgl_rewind_initialize(&instance->rewind.history, length, count, DMGL_REWIND_INTERVAL,
+                (2 * ((2 * length) + 16)) + (count * (length / 8)))) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        if(!(instance->rewind.state = dmgl_buffer_allocate(length))) {
+            result = DMGL_ERROR("Rewind state allocation failed -- %.02f KB (%zu bytes)", length / 1024.f, length);
+            goto exit;
+        }
+
+        instance->rewind.length = length;
+    }
+
+    timespec_get(&instance->frame.begin, TIME_UTC);
+    instance->frame.end = instance->frame.begin;
+
+exit:
+    return result;
+}
+
+/*!
+ * @brief Capture DMGL instance error string on failure.
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[in] result Instance result
+ * @return Instance result
+ */
+static dmgl_error_e dmgl_instance_status(dmgl_instance_t *instance, dmgl_error_e result)
+{
+
+    if(result == DMGL_FAILURE) {
+        snprintf(instance->error, sizeof(instance->error), "%s", dmgl_error());
+    }
+
+    return result;
+}
+
 dmgl_error_e dmgl(const dmgl_t *context)
 {
     dmgl_error_e result;
+    dmgl_instance_t *instance = NULL;
+
+    if((result = dmgl_instance_create(&instance, context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    result = dmgl_instance_run(instance);
+
+exit:
+    dmgl_instance_destroy(instance);
+
+    return result;
+}
+
+dmgl_error_e dmgl_batch_create(dmgl_batch_t **batch, unsigned workers)
+{
+    size_t length = (workers * sizeof(dmgl_batch_worker_t)) + (DMGL_BATCH_ALIGN - 1);
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!workers) {
+        *batch = NULL;
+        result = DMGL_ERROR("Invalid batch worker count -- %u", workers);
+        goto exit;
+    }
+
+    if(!(*batch = dmgl_buffer_allocate(sizeof(**batch)))) {
+        result = DMGL_ERROR("Batch allocation failed -- %.02f KB (%zu bytes)", sizeof(**batch) / 1024.f, sizeof(**batch));
+        goto exit;
+    }
 
-    if((result = dmgl_bus_initialize(context)) != DMGL_SUCCESS) {
+    if(!((*batch)->buffer = dmgl_buffer_allocate(length))) {
+        result = DMGL_ERROR("Batch worker allocation failed -- %.02f KB (%zu bytes)", length / 1024.f, length);
         goto exit;
     }
 
-    if((result = dmgl_service_initialize(context, dmgl_bus_title())) != DMGL_SUCCESS) {
+    (*batch)->worker = (dmgl_batch_worker_t *)(((uintptr_t)(*batch)->buffer + (DMGL_BATCH_ALIGN - 1)) & ~(uintptr_t)(DMGL_BATCH_ALIGN - 1));
+    (*batch)->workers = workers;
+    atomic_init(&(*batch)->failure, SIZE_MAX);
+
+    if(mtx_init(&(*batch)->lock, mtx_plain) != thrd_success) {
+        result = DMGL_ERROR("Batch lock initialization failed");
         goto exit;
     }
 
-    while((result = dmgl_service_poll()) == DMGL_SUCCESS) {
+    if(cnd_init(&(*batch)->start) != thrd_success) {
+        mtx_destroy(&(*batch)->lock);
+        result = DMGL_ERROR("Batch condition initialization failed");
+        goto exit;
+    }
 
-        while((result = dmgl_bus_clock()) != DMGL_COMPLETE) {
+    if(cnd_init(&(*batch)->done) != thrd_success) {
+        cnd_destroy(&(*batch)->start);
+        mtx_destroy(&(*batch)->lock);
+        result = DMGL_ERROR("Batch condition initialization failed");
+        goto exit;
+    }
 
-            if(result == DMGL_FAILURE) {
-                goto exit;
+    (*batch)->ready = true;
+
+    for(uint32_t index = 0; index < workers; ++index) {
+        (*batch)->worker[index].batch = *batch;
+        atomic_init(&(*batch)->worker[index].next, 0);
+    }
+
+    for(uint32_t index = 1; index < workers; ++index) {
+
+        if(((*batch)->worker[index].started = (thrd_create(&(*batch)->worker[index].thread, dmgl_batch_thread,
+                &(*batch)->worker[index]) == thrd_success))) {
+            ++(*batch)->started;
+        }
+    }
+
+exit:
+
+    if(result != DMGL_SUCCESS) {
+        dmgl_batch_destroy(*batch);
+        *batch = NULL;
+    }
+
+    return result;
+}
+
+void dmgl_batch_destroy(dmgl_batch_t *batch)
+{
+
+    if(batch) {
+
+        if(batch->ready) {
+            mtx_lock(&batch->lock);
+            batch->shutdown = true;
+            cnd_broadcast(&batch->start);
+            mtx_unlock(&batch->lock);
+
+            for(uint32_t index = 1; index < batch->workers; ++index) {
+
+                if(batch->worker[index].started) {
+                    thrd_join(batch->worker[index].thread, NULL);
+                }
             }
+
+            cnd_destroy(&batch->done);
+            cnd_destroy(&batch->start);
+            mtx_destroy(&batch->lock);
         }
 
-        if((result = dmgl_service_sync()) != DMGL_SUCCESS) {
+        dmgl_buffer_free(batch->buffer);
+        dmgl_buffer_free(batch);
+    }
+}
+
+dmgl_error_e dmgl_batch_run(dmgl_batch_t *batch, dmgl_instance_t **instance, size_t count, unsigned frames)
+{
+    size_t failure;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!count) {
+        goto exit;
+    }
+
+    batch->instance = instance;
+    batch->frames = frames;
+    atomic_store_explicit(&batch->failure, SIZE_MAX, memory_order_relaxed);
+
+    for(uint32_t index = 0; index < batch->workers; ++index) {
+        atomic_store_explicit(&batch->worker[index].next, (count * index) / batch->workers, memory_order_relaxed);
+        batch->worker[index].end = (count * (index + 1)) / batch->workers;
+    }
+
+    mtx_lock(&batch->lock);
+    batch->pending = batch->started;
+    ++batch->generation;
+    cnd_broadcast(&batch->start);
+    mtx_unlock(&batch->lock);
+    dmgl_batch_work(&batch->worker[0]);
+    mtx_lock(&batch->lock);
+
+    while(batch->pending) {
+        cnd_wait(&batch->done, &batch->lock);
+    }
+
+    mtx_unlock(&batch->lock);
+
+    if((failure = atomic_load(&batch->failure)) != SIZE_MAX) {
+        result = DMGL_ERROR("Batch instance %zu failed -- %s", failure, instance[failure]->error);
+        goto exit;
+    }
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_instance_batch(dmgl_instance_t **instance, size_t count, unsigned frames, unsigned workers)
+{
+    dmgl_batch_t *batch = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!workers) {
+        result = DMGL_ERROR("Invalid batch worker count -- %u", workers);
+        goto exit;
+    }
+
+    if(!count) {
+        goto exit;
+    }
+
+    if((result = dmgl_batch_create(&batch, (workers < count) ? workers : count)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    result = dmgl_batch_run(batch, instance, count, frames);
+
+exit:
+    dmgl_batch_destroy(batch);
+
+    return result;
+}
+
+dmgl_error_e dmgl_instance_create(dmgl_instance_t **instance, const dmgl_t *context)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(*instance = dmgl_buffer_allocate(sizeof(**instance)))) {
+        result = DMGL_ERROR("Instance allocation failed -- %.02f KB (%zu bytes)", sizeof(**instance) / 1024.f, sizeof(**instance));
+        goto exit;
+    }
+
+    if((result = dmgl_bus_initialize(&(*instance)->bus, context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    result = dmgl_instance_setup(*instance, context);
+
+exit:
+
+    if(result != DMGL_SUCCESS) {
+        dmgl_instance_destroy(*instance);
+        *instance = NULL;
+    }
+
+    return result;
+}
+
+void dmgl_instance_destroy(dmgl_instance_t *instance)
+{
+
+    if(instance) {
+        dmgl_buffer_free(instance->movie.data);
+        dmgl_buffer_free(instance->rewind.state);
+        dmgl_rewind_uninitialize(&instance->rewind.history);
+        dmgl_service_uninitialize(instance->service);
+        dmgl_bus_uninitialize(instance->bus);
+        dmgl_buffer_free(instance);
+    }
+}
+
+const char *dmgl_instance_error(const dmgl_instance_t *instance)
+{
+    return instance->error;
+}
+
+dmgl_error_e dmgl_instance_fork(dmgl_instance_t **instance, dmgl_instance_t *parent, const dmgl_t *context)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(*instance = dmgl_buffer_allocate(sizeof(**instance)))) {
+        result = DMGL_ERROR("Instance allocation failed -- %.02f KB (%zu bytes)", sizeof(**instance) / 1024.f, sizeof(**instance));
+        goto exit;
+    }
+
+    if((result = dmgl_bus_fork(&(*instance)->bus, parent->bus)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    (*instance)->frame.count = parent->frame.count;
+
+    if((result = dmgl_instance_setup(*instance, context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+exit:
+
+    if(result != DMGL_SUCCESS) {
+        dmgl_instance_destroy(*instance);
+        *instance = NULL;
+    }
+
+    return dmgl_instance_status(parent, result);
+}
+
+dmgl_error_e dmgl_instance_frame(dmgl_instance_t *instance)
+{
+    dmgl_error_e result;
+
+    if(instance->frame.limit && (instance->frame.count >= instance->frame.limit)) {
+        result = DMGL_COMPLETE;
+        goto exit;
+    }
+
+    if((result = dmgl_service_poll(instance->service)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if(instance->movie.data && ((result = dmgl_instance_record(instance)) != DMGL_SUCCESS)) {
+        goto exit;
+    }
+
+    while((result = dmgl_bus_clock(instance->bus)) != DMGL_COMPLETE) {
+
+        if(result == DMGL_FAILURE) {
             goto exit;
         }
     }
 
+    dmgl_service_frame(instance->service, dmgl_bus_frame(instance->bus));
+
+    if((result = dmgl_service_sync(instance->service)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if(instance->rewind.state) {
+        dmgl_state_save(instance, instance->rewind.state, instance->rewind.length);
+        dmgl_rewind_push(&instance->rewind.history, instance->rewind.state);
+    }
+
+    ++instance->frame.count;
+    timespec_get(&instance->frame.end, TIME_UTC);
+
+exit:
+    return dmgl_instance_status(instance, result);
+}
+
+dmgl_error_e dmgl_instance_hotspot(dmgl_instance_t *instance, dmgl_hotspot_t *hotspot, size_t *count)
+{
+    const dmgl_histogram_t *histogram;
+    dmgl_histogram_entry_t *entry = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(histogram = dmgl_bus_histogram(instance->bus))) {
+        *count = 0;
+        result = DMGL_ERROR("Hot-PC sampling disabled");
+        goto exit;
+    }
+
+    if(*count && !(entry = dmgl_buffer_allocate(*count * sizeof(*entry)))) {
+        result = DMGL_ERROR("Hot-PC sample allocation failed -- %.02f KB (%zu bytes)", (*count * sizeof(*entry)) / 1024.f, *count * sizeof(*entry));
+        *count = 0;
+        goto exit;
+    }
+
+    *count = dmgl_histogram_top(histogram, entry, *count);
+
+    for(size_t index = 0; index < *count; ++index) {
+        hotspot[index].bank = entry[index].key >> 16;
+        hotspot[index].address = entry[index].key & 0xFFFF;
+        hotspot[index].count = entry[index].count;
+        hotspot[index].ratio = entry[index].count / (double)histogram->total;
+    }
+
 exit:
-    dmgl_service_uninitialize();
-    dmgl_bus_uninitialize();
+    dmgl_buffer_free(entry);
+
+    return dmgl_instance_status(instance, result);
+}
+
+dmgl_error_e dmgl_instance_profile(dmgl_instance_t *instance, dmgl_profile_t *profile)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+#if PROFILE
+    dmgl_bus_profile(instance->bus, profile);
+#else
+    memset(profile, 0, sizeof(*profile));
+    result = DMGL_ERROR("Opcode profile unavailable -- rebuild with PROFILE enabled");
+#endif /* PROFILE */
+
+    return dmgl_instance_status(instance, result);
+}
+
+void dmgl_instance_statistics(const dmgl_instance_t *instance, dmgl_statistics_t *statistics)
+{
+    memset(statistics, 0, sizeof(*statistics));
+    statistics->frames = instance->frame.count;
+    statistics->elapsed = (instance->frame.end.tv_sec - instance->frame.begin.tv_sec) + ((instance->frame.end.tv_nsec - instance->frame.begin.tv_nsec) / 1000000000.0);
+
+    if(statistics->elapsed > 0) {
+        statistics->rate = statistics->frames / statistics->elapsed;
+        statistics->frequency = dmgl_bus_cycle(instance->bus) / (statistics->elapsed * 1000000.0);
+    }
+}
+
+dmgl_error_e dmgl_instance_run(dmgl_instance_t *instance)
+{
+    dmgl_error_e result;
+
+    while((result = dmgl_instance_frame(instance)) == DMGL_SUCCESS) {
+        continue;
+    }
 
     return (result == DMGL_COMPLETE) ? DMGL_SUCCESS : result;
 }
 
+size_t dmgl_movie_length(const dmgl_instance_t *instance)
+{
+    return instance->movie.data ? (sizeof(dmgl_movie_header_t) + instance->movie.length) : 0;
+}
+
+dmgl_error_e dmgl_movie_save(dmgl_instance_t *instance, void *data, size_t length)
+{
+    dmgl_movie_header_t header = { .magic = DMGL_MOVIE_MAGIC, .version = DMGL_MOVIE_VERSION, .hash = instance->movie.hash, .length = instance->movie.length };
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!instance->movie.data) {
+        result = DMGL_ERROR("Movie recording disabled");
+        goto exit;
+    }
+
+    if(length < dmgl_movie_length(instance)) {
+        result = DMGL_ERROR("Movie buffer too small -- %zu bytes (expecting %zu bytes)", length, dmgl_movie_length(instance));
+        goto exit;
+    }
+
+    memcpy(data, &header, sizeof(header));
+    memcpy((uint8_t *)data + sizeof(header), instance->movie.data, instance->movie.length);
+
+exit:
+    return dmgl_instance_status(instance, result);
+}
+
+size_t dmgl_state_length(const dmgl_instance_t *instance)
+{
+    return sizeof(dmgl_state_header_t) + dmgl_bus_save(instance->bus, NULL);
+}
+
+dmgl_error_e dmgl_state_load(dmgl_instance_t *instance, const void *data, size_t length)
+{
+    dmgl_state_header_t header;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(length < sizeof(header)) {
+        result = DMGL_ERROR("State buffer too small -- %zu bytes", length);
+        goto exit;
+    }
+
+    memcpy(&header, data, sizeof(header));
+
+    if(header.magic != DMGL_STATE_MAGIC) {
+        result = DMGL_ERROR("Invalid state magic -- %08X", header.magic);
+        goto exit;
+    }
+
+    if(header.version != DMGL_STATE_VERSION) {
+        result = DMGL_ERROR("Unsupported state version -- %u", header.version);
+        goto exit;
+    }
+
+    if((header.length != dmgl_state_length(instance)) || (length < header.length)) {
+        result = DMGL_ERROR("Invalid state length -- %zu bytes", (size_t)header.length);
+        goto exit;
+    }
+
+    result = dmgl_bus_load(instance->bus, (const uint8_t *)data + sizeof(header));
+
+exit:
+    return dmgl_instance_status(instance, result);
+}
+
+dmgl_error_e dmgl_state_rewind(dmgl_instance_t *instance, int frames)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!instance->rewind.state) {
+        result = DMGL_ERROR("Rewind disabled");
+        goto exit;
+    }
+
+    for(; (frames > 0) && (dmgl_rewind_count(&instance->rewind.history) > 1); --frames) {
+        dmgl_rewind_pop(&instance->rewind.history, instance->rewind.state);
+    }
+
+    if((result = dmgl_rewind_pop(&instance->rewind.history, instance->rewind.state)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if((result = dmgl_state_load(instance, instance->rewind.state, instance->rewind.length)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    dmgl_rewind_push(&instance->rewind.history, instance->rewind.state);
+
+exit:
+    return dmgl_instance_status(instance, result);
+}
+
+dmgl_error_e dmgl_state_save(dmgl_instance_t *instance, void *data, size_t length)
+{
+    dmgl_state_header_t header = { .magic = DMGL_STATE_MAGIC, .version = DMGL_STATE_VERSION, .length = dmgl_state_length(instance) };
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(length < header.length) {
+        result = DMGL_ERROR("State buffer too small -- %zu bytes (expecting %zu bytes)", length, (size_t)header.length);
+        goto exit;
+    }
+
+    memcpy(data, &header, sizeof(header));
+    dmgl_bus_save(instance->bus, (uint8_t *)data + sizeof(header));
+
+exit:
+    return dmgl_instance_status(instance, result);
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
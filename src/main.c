@@ -24,18 +24,46 @@
  * @brief Main application.
  */
 
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
 #include <getopt.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <dmgl.h>
 
+#define HOTSPOT_COUNT 16    /*!< Hot-PC samples shown on exit */
+
+/*!
+ * @struct symbol_t
+ * @brief Symbol, parsed from an RGBDS/no$gmb symbol file.
+ */
+typedef struct {
+    unsigned bank;          /*!< Symbol bank */
+    unsigned address;       /*!< Symbol address */
+    const char *name;       /*!< Symbol name, not NUL-terminated */
+    int length;             /*!< Symbol name length, in characters */
+} symbol_t;
+
 static const struct option OPTION[] = {
     { "bootloader", required_argument, NULL, 'b' },
+    { "frames", required_argument, NULL, 'f' },
     { "help", no_argument, NULL, 'h' },
+    { "input", required_argument, NULL, 'i' },
+    { "movie", required_argument, NULL, 'm' },
+    { "profile", required_argument, NULL, 'o' },
+    { "record", required_argument, NULL, 'c' },
+    { "report", no_argument, NULL, 'r' },
+    { "sample", required_argument, NULL, 'a' },
     { "scale", required_argument, NULL, 's' },
+    { "speed", required_argument, NULL, 'p' },
+    { "symbols", required_argument, NULL, 'y' },
     { "version", no_argument, NULL, 'v' },
     { NULL, 0, NULL, 0 },
     };
@@ -45,44 +73,140 @@ extern "C" {
 #endif /* __cplusplus */
 
 /*!
- * @brief Read file at path.
+ * @brief Map file at path, read-only.
  * @param[in] base Constant pointer to base path
  * @param[in] path Constant pointer to file path
  * @param[out] data Pointer to data pointer
  * @param[out] length Pointer to data length, in bytes
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
-static dmgl_error_e read_file(const char *base, const char *path, uint8_t **data, size_t *length)
+static dmgl_error_e map_file(const char *base, const char *path, uint8_t **data, size_t *length)
 {
-    int file_length;
-    FILE *file = NULL;
+    int file;
+    struct stat status = {};
     dmgl_error_e result = DMGL_SUCCESS;
 
-    if(!(file = fopen(path, "rb"))) {
+    if((file = open(path, O_RDONLY)) == -1) {
         fprintf(stderr, "%s: File does not exist -- %s\n", base, path);
         result = DMGL_FAILURE;
         goto exit;
     }
 
-    fseek(file, 0, SEEK_END);
-
-    if((file_length = ftell(file)) <= 0) {
+    if(fstat(file, &status) || (status.st_size <= 0)) {
         fprintf(stderr, "%s: File is empty -- %s\n", base, path);
         result = DMGL_FAILURE;
         goto exit;
     }
 
-    fseek(file, 0, SEEK_SET);
-    *length = file_length;
+    if((*data = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, file, 0)) == MAP_FAILED) {
+        fprintf(stderr, "%s: Failed to map file -- %s\n", base, path);
+        *data = NULL;
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    *length = status.st_size;
+    posix_madvise(*data, *length, POSIX_MADV_WILLNEED);
+    posix_madvise(*data, *length, POSIX_MADV_RANDOM);
+
+exit:
+
+    if(file != -1) {
+        close(file);
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Unmap file mapped by map_file.
+ * @param[in] data Pointer to data
+ * @param[in] length Data length, in bytes
+ */
+static void unmap_file(uint8_t *data, size_t length)
+{
+
+    if(data) {
+        munmap(data, length);
+    }
+}
+
+/*!
+ * @brief Parse symbols from RGBDS/no$gmb symbol file data (BB:AAAA name, one per line, ; comments).
+ * @param[in] base Constant pointer to base path
+ * @param[in] data Constant pointer to symbol file data
+ * @param[in] length Symbol file data length, in bytes
+ * @param[out] symbol Pointer to symbol array pointer, free with free
+ * @param[out] count Pointer to symbol count
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e parse_symbols(const char *base, const char *data, size_t length, symbol_t **symbol, size_t *count)
+{
+    size_t capacity = 0;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(size_t offset = 0; offset < length;) {
+        char line[256] = {};
+        int begin = 0, end = 0;
+        unsigned bank, address;
+        const char *next = memchr(data + offset, '\n', length - offset);
+        size_t line_length = next ? (size_t)(next - (data + offset)) : (length - offset);
+
+        memcpy(line, data + offset, (line_length < (sizeof(line) - 1)) ? line_length : (sizeof(line) - 1));
+
+        if((sscanf(line, "%x:%x %n%*s%n", &bank, &address, &begin, &end) == 2) && (end > begin)) {
 
-    if((*data = calloc(*length, sizeof(uint8_t))) == NULL) {
-        fprintf(stderr, "%s: Failed to allocate buffer -- %.2f KB (%zu bytes)\n", base, *length / 1024.f, *length);
+            if(*count == capacity) {
+                symbol_t *resized;
+
+                capacity = capacity ? (2 * capacity) : 256;
+
+                if(!(resized = realloc(*symbol, capacity * sizeof(*resized)))) {
+                    fprintf(stderr, "%s: Failed to allocate symbols -- %zu entries\n", base, capacity);
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+
+                *symbol = resized;
+            }
+
+            (*symbol)[(*count)++] = (symbol_t){ .bank = bank, .address = address, .name = data + offset + begin, .length = end - begin };
+        }
+
+        offset += line_length + 1;
+    }
+
+exit:
+    return result;
+}
+
+/*!
+ * @brief Save movie recorded by instance to file at path.
+ * @param[in] base Constant pointer to base path
+ * @param[in] path Constant pointer to file path
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e save_movie(const char *base, const char *path, dmgl_instance_t *instance)
+{
+    FILE *file = NULL;
+    uint8_t *data = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length = dmgl_movie_length(instance);
+
+    if(!(data = malloc(length))) {
+        fprintf(stderr, "%s: Failed to allocate movie -- %zu bytes\n", base, length);
         result = DMGL_FAILURE;
         goto exit;
     }
 
-    if(fread(*data, sizeof(uint8_t), *length, file) != *length) {
-        fprintf(stderr, "%s: Failed to read file -- %s\n", base, path);
+    if((result = dmgl_movie_save(instance, data, length)) != DMGL_SUCCESS) {
+        fprintf(stderr, "%s: %s\n", base, dmgl_instance_error(instance));
+        goto exit;
+    }
+
+    if(!(file = fopen(path, "wb")) || (fwrite(data, sizeof(*data), length, file) != length)) {
+        fprintf(stderr, "%s: Failed to write file -- %s\n", base, path);
         result = DMGL_FAILURE;
         goto exit;
     }
@@ -93,6 +217,76 @@ exit:
         fclose(file);
     }
 
+    free(data);
+
+    return result;
+}
+
+/*!
+ * @brief Save opcode profile of instance to file at path, as JSON if path ends in .json, CSV otherwise.
+ * @param[in] base Constant pointer to base path
+ * @param[in] path Constant pointer to file path
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e save_profile(const char *base, const char *path, dmgl_instance_t *instance)
+{
+    FILE *file = NULL;
+    dmgl_profile_t *profile = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+    const char *extension = strrchr(path, '.');
+    bool json = extension && !strcmp(extension, ".json");
+
+    if(!(profile = malloc(sizeof(*profile)))) {
+        fprintf(stderr, "%s: Failed to allocate opcode profile -- %zu bytes\n", base, sizeof(*profile));
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if((result = dmgl_instance_profile(instance, profile)) != DMGL_SUCCESS) {
+        fprintf(stderr, "%s: %s\n", base, dmgl_instance_error(instance));
+        goto exit;
+    }
+
+    if(!(file = fopen(path, "w"))) {
+        fprintf(stderr, "%s: Failed to write file -- %s\n", base, path);
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    fprintf(file, json ? "[" : "table,opcode,count,cycles\n");
+
+    for(int table = 0, first = 1; table < 2; ++table) {
+
+        for(int opcode = 0; opcode < 256; ++opcode) {
+
+            if(!profile->cycle[table][opcode]) {
+                continue;
+            }
+
+            if(json) {
+                fprintf(file, "%s\n  {\"table\": \"%s\", \"opcode\": \"0x%02X\", \"count\": %lu, \"cycles\": %lu}", first ? "" : ",",
+                    table ? "extended" : "base", opcode, profile->count[table][opcode], profile->cycle[table][opcode]);
+            } else {
+                fprintf(file, "%s,0x%02X,%lu,%lu\n", table ? "extended" : "base", opcode, profile->count[table][opcode], profile->cycle[table][opcode]);
+            }
+
+            first = 0;
+        }
+    }
+
+    if(json) {
+        fprintf(file, "\n]\n");
+    }
+
+exit:
+
+    if(file) {
+        fclose(file);
+    }
+
+    free(profile);
+
     return result;
 }
 
@@ -110,7 +304,10 @@ static void show_help(const char *base)
     while(OPTION[flag].name) {
         char message[22] = {};
         const char *description[] = {
-            "Specify bootloader path", "Show help information", "Set window scaling", "Show version information",
+            "Specify bootloader path", "Set frame limit", "Show help information", "Specify input script path",
+            "Specify movie replay path", "Export opcode profile to path (CSV, or JSON for .json)", "Record movie to path",
+            "Report frame rate and clock speed", "Sample hot PCs every interval cycles", "Set window scaling", "Set speed multiplier (0 for uncapped)",
+            "Specify hot PC symbol path", "Show version information",
             };
 
         snprintf(message, sizeof(message), "   -%c, --%s", OPTION[flag].val, OPTION[flag].name);
@@ -124,6 +321,51 @@ static void show_help(const char *base)
     }
 }
 
+/*!
+ * @brief Show hot-PC samples of instance, symbolized against the nearest preceding symbol in the same bank and region.
+ * @param[in] base Constant pointer to base path
+ * @param[in,out] instance Pointer to DMGL instance handle
+ * @param[in] symbol Constant pointer to symbol array
+ * @param[in] symbols Symbol count
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e show_hotspot(const char *base, dmgl_instance_t *instance, const symbol_t *symbol, size_t symbols)
+{
+    dmgl_hotspot_t hotspot[HOTSPOT_COUNT] = {};
+    size_t count = HOTSPOT_COUNT;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if((result = dmgl_instance_hotspot(instance, hotspot, &count)) != DMGL_SUCCESS) {
+        fprintf(stderr, "%s: %s\n", base, dmgl_instance_error(instance));
+        goto exit;
+    }
+
+    for(size_t index = 0; index < count; ++index) {
+        const symbol_t *nearest = NULL;
+        unsigned region = (hotspot[index].address < 0x8000) ? (hotspot[index].address >> 14) : (hotspot[index].address >> 13);
+
+        for(size_t entry = 0; entry < symbols; ++entry) {
+
+            if((symbol[entry].bank == hotspot[index].bank) && (symbol[entry].address <= hotspot[index].address)
+                    && (region == ((symbol[entry].address < 0x8000) ? (symbol[entry].address >> 14) : (symbol[entry].address >> 13)))
+                    && (!nearest || (symbol[entry].address > nearest->address))) {
+                nearest = &symbol[entry];
+            }
+        }
+
+        fprintf(stdout, "%6.02f%%  %02X:%04X", hotspot[index].ratio * 100.0, hotspot[index].bank, hotspot[index].address);
+
+        if(nearest) {
+            fprintf(stdout, "  %.*s+0x%X", nearest->length, nearest->name, hotspot[index].address - nearest->address);
+        }
+
+        fprintf(stdout, "\n");
+    }
+
+exit:
+    return result;
+}
+
 /*!
  * @brief Show version information.
  */
@@ -137,16 +379,24 @@ static void show_version(void)
 int main(int argc, char *argv[])
 {
     int option, option_index;
-    uint8_t *bootloader = NULL, *cartridge = NULL;
-    size_t bootloader_length = 0, cartridge_length = 0;
+    bool report = false;
+    const char *profile = NULL, *record = NULL;
+    uint8_t *bootloader = NULL, *cartridge = NULL, *input = NULL, *movie = NULL, *symbols = NULL;
+    size_t bootloader_length = 0, cartridge_length = 0, input_length = 0, movie_length = 0, symbols_length = 0;
+    symbol_t *symbol = NULL;
+    size_t symbol_count = 0;
     dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
     opterr = 1;
 
-    while((option = getopt_long(argc, argv, "b:hs:v", OPTION, &option_index)) != -1) {
+    while((option = getopt_long(argc, argv, "a:b:c:f:hi:m:o:p:rs:vy:", OPTION, &option_index)) != -1) {
 
         switch(option) {
+            case 'a':
+                context.sample.interval = strtol(optarg, NULL, 10);
+                break;
             case 'b':
 
                 if(bootloader) {
@@ -154,22 +404,93 @@ int main(int argc, char *argv[])
                     goto exit;
                 }
 
-                if((result = read_file(argv[0], optarg, &bootloader, &bootloader_length)) != DMGL_SUCCESS) {
+                if((result = map_file(argv[0], optarg, &bootloader, &bootloader_length)) != DMGL_SUCCESS) {
                     goto exit;
                 }
 
                 context.bootloader.data = bootloader;
                 context.bootloader.length = bootloader_length;
                 break;
+            case 'c':
+
+                if(record) {
+                    fprintf(stderr, "%s: Redefined movie record path -- %s\n", argv[0], optarg);
+                    goto exit;
+                }
+
+                record = optarg;
+                context.movie.record = true;
+                break;
+            case 'f':
+                context.frame.limit = strtol(optarg, NULL, 10);
+                break;
             case 'h':
                 show_help(argv[0]);
                 goto exit;
+            case 'i':
+
+                if(input) {
+                    fprintf(stderr, "%s: Redefined input script path -- %s\n", argv[0], optarg);
+                    goto exit;
+                }
+
+                if((result = map_file(argv[0], optarg, &input, &input_length)) != DMGL_SUCCESS) {
+                    goto exit;
+                }
+
+                context.input.data = input;
+                context.input.length = input_length;
+                break;
+            case 'm':
+
+                if(movie) {
+                    fprintf(stderr, "%s: Redefined movie replay path -- %s\n", argv[0], optarg);
+                    goto exit;
+                }
+
+                if((result = map_file(argv[0], optarg, &movie, &movie_length)) != DMGL_SUCCESS) {
+                    goto exit;
+                }
+
+                context.movie.data = movie;
+                context.movie.length = movie_length;
+                break;
+            case 'o':
+
+                if(profile) {
+                    fprintf(stderr, "%s: Redefined opcode profile path -- %s\n", argv[0], optarg);
+                    goto exit;
+                }
+
+                profile = optarg;
+                break;
+            case 'p':
+
+                if(!(context.speed.multiplier = strtol(optarg, NULL, 10))) {
+                    context.speed.uncapped = true;
+                }
+                break;
+            case 'r':
+                report = true;
+                break;
             case 's':
                 context.window.scale = strtol(optarg, NULL, 10);
                 break;
             case 'v':
                 show_version();
                 goto exit;
+            case 'y':
+
+                if(symbols) {
+                    fprintf(stderr, "%s: Redefined symbol path -- %s\n", argv[0], optarg);
+                    goto exit;
+                }
+
+                if(((result = map_file(argv[0], optarg, &symbols, &symbols_length)) != DMGL_SUCCESS)
+                        || ((result = parse_symbols(argv[0], (const char *)symbols, symbols_length, &symbol, &symbol_count)) != DMGL_SUCCESS)) {
+                    goto exit;
+                }
+                break;
             case '?':
             default:
                 result = DMGL_FAILURE;
@@ -184,7 +505,7 @@ int main(int argc, char *argv[])
             goto exit;
         }
 
-        if((result = read_file(argv[0], argv[option], &cartridge, &cartridge_length)) != DMGL_SUCCESS) {
+        if((result = map_file(argv[0], argv[option], &cartridge, &cartridge_length)) != DMGL_SUCCESS) {
             goto exit;
         }
 
@@ -197,14 +518,46 @@ int main(int argc, char *argv[])
         goto exit;
     }
 
-    if((result = dmgl(&context)) != DMGL_SUCCESS) {
+    if((result = dmgl_instance_create(&instance, &context)) != DMGL_SUCCESS) {
         fprintf(stderr, "%s: %s\n", argv[0], dmgl_error());
         goto exit;
     }
 
+    if((result = dmgl_instance_run(instance)) != DMGL_SUCCESS) {
+        fprintf(stderr, "%s: %s\n", argv[0], dmgl_instance_error(instance));
+    }
+
+    if(record && (save_movie(argv[0], record, instance) != DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+    }
+
+    if(profile && (save_profile(argv[0], profile, instance) != DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+    }
+
+    if(context.sample.interval && (show_hotspot(argv[0], instance, symbol, symbol_count) != DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+    }
+
+    if(result != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if(report) {
+        dmgl_statistics_t statistics = {};
+
+        dmgl_instance_statistics(instance, &statistics);
+        fprintf(stdout, "%lu frames, %.03f seconds, %.01f FPS, %.02f MHz\n", statistics.frames, statistics.elapsed, statistics.rate, statistics.frequency);
+    }
+
 exit:
-    free(bootloader);
-    free(cartridge);
+    dmgl_instance_destroy(instance);
+    unmap_file(bootloader, bootloader_length);
+    unmap_file(cartridge, cartridge_length);
+    unmap_file(input, input_length);
+    unmap_file(movie, movie_length);
+    unmap_file(symbols, symbols_length);
+    free(symbol);
 
     return result;
 }
@@ -0,0 +1,104 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file headless.c
+ * @brief Headless service interface.
+ */
+
+#include <common.h>
+
+#include <bus.h>
+#include <service.h>
+
+/*!
+ * @struct dmgl_service_s
+ * @brief Headless service context.
+ */
+struct dmgl_service_s {
+    uint32_t frame;                 /*!< Headless frame counter */
+    const uint8_t *color;           /*!< Headless frame colors, owned by the bus */
+
+    struct {
+        const uint8_t *data;        /*!< Headless input data, one button mask per frame */
+        size_t length;              /*!< Headless input data length, in frames */
+    } input;                        /*!< Headless input */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+bool dmgl_service_button(const dmgl_service_t *service, dmgl_button_e button)
+{
+    bool result = false;
+
+    if(service->frame < service->input.length) {
+        result = (service->input.data[service->frame] & (1 << button)) ? true : false;
+    }
+
+    return result;
+}
+
+void dmgl_service_frame(dmgl_service_t *service, const uint8_t *color)
+{
+    service->color = color;
+}
+
+dmgl_error_e dmgl_service_initialize(dmgl_service_t **service, const dmgl_t *context, dmgl_bus_t *bus, const char *title)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(!(*service = dmgl_buffer_allocate(sizeof(**service)))) {
+        result = DMGL_ERROR("Service allocation failed -- %.02f KB (%zu bytes)", sizeof(**service) / 1024.f, sizeof(**service));
+        goto exit;
+    }
+
+    if(context->input.data && (context->input.length > 0)) {
+        (*service)->input.data = context->input.data;
+        (*service)->input.length = context->input.length;
+    }
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_service_poll(dmgl_service_t *service)
+{
+    return DMGL_SUCCESS;
+}
+
+dmgl_error_e dmgl_service_sync(dmgl_service_t *service)
+{
+    /* Headless frames are never paced, so the speed multiplier has no effect */
+    ++service->frame;
+
+    return DMGL_SUCCESS;
+}
+
+void dmgl_service_uninitialize(dmgl_service_t *service)
+{
+    dmgl_buffer_free(service);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -31,21 +31,46 @@
 #include <service.h>
 
 /*!
- * @struct dmgl_sdl_t
- * @brief SDL context.
+ * @struct dmgl_service_s
+ * @brief SDL service context.
  */
-typedef struct {
+struct dmgl_service_s {
+    dmgl_bus_t *bus;                /*!< SDL bus context */
+    const char *title;              /*!< SDL title string */
+    bool initialized;               /*!< SDL subsystem initialized flag */
+    bool vsync;                     /*!< SDL vsync flag */
     uint32_t tick;                  /*!< SDL tick counter */
+    uint32_t present;               /*!< SDL present tick counter */
     uint32_t pixel[160 * 144];      /*!< SDL pixel buffer */
+    const uint8_t *color;           /*!< SDL frame colors, owned by the bus, NULL if cleared */
+
+    struct {
+        const uint8_t *data;        /*!< SDL input data, one button mask per frame, replayed before live input */
+        size_t length;              /*!< SDL input data length, in frames */
+        size_t frame;               /*!< SDL input frame counter */
+    } input;                        /*!< SDL input */
+
+    struct {
+        float period;               /*!< SDL frame period, in milliseconds */
+        bool uncapped;              /*!< SDL uncapped speed flag */
+    } speed;                        /*!< SDL speed */
+
+    struct {
+        uint32_t frame;             /*!< SDL statistics frame counter */
+        uint32_t tick;              /*!< SDL statistics tick counter */
+    } statistics;                   /*!< SDL statistics */
+
     SDL_Window *window;             /*!< SDL window handle */
     SDL_Renderer *renderer;         /*!< SDL renderer handle */
     SDL_Texture *texture;           /*!< SDL texture handle */
     SDL_Cursor *cursor;             /*!< SDL cursor handle */
     SDL_GameController *controller; /*!< SDL controller handle */
     SDL_JoystickID joystick;        /*!< SDL joystick ID */
-} dmgl_sdl_t;
+};
 
-static dmgl_sdl_t g_sdl = {};       /*!< SDL context */
+static const uint32_t COLOR[] = {
+    0xFF081820, 0xFF346856, 0xFF88C070, 0xFFE0F8D0,
+    };  /*!< SDL colors, in ARGB8888 */
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,29 +78,37 @@ extern "C" {
 
 /*!
  * @brief Clear service pixel buffer.
+ * @param[in,out] service Pointer to service context
  */
-static void dmgl_service_clear(void)
+static void dmgl_service_clear(dmgl_service_t *service)
 {
+    uint8_t color[160];
 
-    for(uint8_t y = 0; y < 144; ++y) {
+    memset(color, DMGL_COLOR_WHITE, sizeof(color));
 
-        for(uint8_t x = 0; x < 160; ++x) {
-            dmgl_service_pixel(DMGL_COLOR_WHITE, x, y);
-        }
+    for(uint8_t y = 0; y < 144; ++y) {
+        dmgl_pixel_expand(color, COLOR, &service->pixel[y * 160], 160);
     }
+
+    service->color = NULL;
 }
 
-bool dmgl_service_button(dmgl_button_e button)
+bool dmgl_service_button(const dmgl_service_t *service, dmgl_button_e button)
 {
     bool result = false;
 
-    if(g_sdl.controller) {
+    if(service->input.frame < service->input.length) {
+        result = (service->input.data[service->input.frame] & (1 << button)) ? true : false;
+        goto exit;
+    }
+
+    if(service->controller) {
         const SDL_GameControllerButton keys[] = {
             SDL_CONTROLLER_BUTTON_A, SDL_CONTROLLER_BUTTON_B, SDL_CONTROLLER_BUTTON_BACK, SDL_CONTROLLER_BUTTON_START,
             SDL_CONTROLLER_BUTTON_DPAD_RIGHT, SDL_CONTROLLER_BUTTON_DPAD_LEFT, SDL_CONTROLLER_BUTTON_DPAD_UP, SDL_CONTROLLER_BUTTON_DPAD_DOWN,
             };
 
-        result = SDL_GameControllerGetButton(g_sdl.controller, keys[button]) ? true : false;
+        result = SDL_GameControllerGetButton(service->controller, keys[button]) ? true : false;
     }
 
     if(!result) {
@@ -87,12 +120,18 @@ bool dmgl_service_button(dmgl_button_e button)
         result = SDL_GetKeyboardState(NULL)[keys[button]] ? true : false;
     }
 
+exit:
     return result;
 }
 
-dmgl_error_e dmgl_service_initialize(const dmgl_t *context, const char *title)
+void dmgl_service_frame(dmgl_service_t *service, const uint8_t *color)
+{
+    service->color = color;
+}
+
+dmgl_error_e dmgl_service_initialize(dmgl_service_t **service, const dmgl_t *context, dmgl_bus_t *bus, const char *title)
 {
-    int scale = 2;
+    int multiplier = 1, scale = 2;
     dmgl_error_e result = DMGL_SUCCESS;
     const char *controller_map[] = {
         "03000000790000001100000010010000,Retro Controller,a:b1,b:b2,back:b8,dpdown:+a1,dpleft:-a0,dpright:+a0,dpup:-a1,leftshoulder:b6,lefttrigger:b7,rightshoulder:b4,righttrigger:b5,start:b9,x:b0,y:b3,platform:Linux",
@@ -108,32 +147,60 @@ dmgl_error_e dmgl_service_initialize(const dmgl_t *context, const char *title)
         }
     }
 
-    if(SDL_Init(SDL_INIT_GAMECONTROLLER | SDL_INIT_VIDEO)) {
-        result = DMGL_ERROR("SDL_Init failed -- %s", SDL_GetError());
+    if(context->speed.multiplier) {
+        multiplier = context->speed.multiplier;
+
+        if(multiplier < 1) {
+            multiplier = 1;
+        } else if(multiplier > 16) {
+            multiplier = 16;
+        }
+    }
+
+    if(!(*service = dmgl_buffer_allocate(sizeof(**service)))) {
+        result = DMGL_ERROR("Service allocation failed -- %.02f KB (%zu bytes)", sizeof(**service) / 1024.f, sizeof(**service));
         goto exit;
     }
 
-    if(!(g_sdl.window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 160 * scale, 144 * scale, 0))) {
+    (*service)->bus = bus;
+    (*service)->title = title;
+    (*service)->speed.period = (1000.f * DMGL_BUS_FRAME) / ((float)DMGL_BUS_CLOCK * multiplier);
+    (*service)->speed.uncapped = context->speed.uncapped ? true : false;
+    (*service)->vsync = (multiplier == 1) && !(*service)->speed.uncapped;
+
+    if(context->input.data && (context->input.length > 0)) {
+        (*service)->input.data = context->input.data;
+        (*service)->input.length = context->input.length;
+    }
+
+    if(SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER | SDL_INIT_VIDEO)) {
+        result = DMGL_ERROR("SDL_InitSubSystem failed -- %s", SDL_GetError());
+        goto exit;
+    }
+
+    (*service)->initialized = true;
+
+    if(!((*service)->window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 160 * scale, 144 * scale, 0))) {
         result = DMGL_ERROR("SDL_CreateWindow failed -- %s", SDL_GetError());
         goto exit;
     }
 
-    if(!(g_sdl.renderer = SDL_CreateRenderer(g_sdl.window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC))) {
+    if(!((*service)->renderer = SDL_CreateRenderer((*service)->window, -1, SDL_RENDERER_ACCELERATED | ((*service)->vsync ? SDL_RENDERER_PRESENTVSYNC : 0)))) {
         result = DMGL_ERROR("SDL_CreateRenderer failed -- %s", SDL_GetError());
         goto exit;
     }
 
-    if(SDL_RenderSetLogicalSize(g_sdl.renderer, 160, 144)) {
+    if(SDL_RenderSetLogicalSize((*service)->renderer, 160, 144)) {
         result = DMGL_ERROR("SDL_RenderSetLogicalSize failed -- %s", SDL_GetError());
         goto exit;
     }
 
-    if(SDL_SetRenderDrawColor(g_sdl.renderer, 0, 0, 0, 0)) {
+    if(SDL_SetRenderDrawColor((*service)->renderer, 0, 0, 0, 0)) {
         result = DMGL_ERROR("SDL_SetRenderDrawColor failed -- %s", SDL_GetError());
         goto exit;
     }
 
-    if(SDL_SetHint(SDL_HINT_RENDER_VSYNC, "1") == SDL_FALSE) {
+    if(SDL_SetHint(SDL_HINT_RENDER_VSYNC, (*service)->vsync ? "1" : "0") == SDL_FALSE) {
         result = DMGL_ERROR("SDL_SetHint failed -- %s", SDL_GetError());
         goto exit;
     }
@@ -143,17 +210,17 @@ dmgl_error_e dmgl_service_initialize(const dmgl_t *context, const char *title)
         goto exit;
     }
 
-    if(!(g_sdl.texture = SDL_CreateTexture(g_sdl.renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 160, 144))) {
+    if(!((*service)->texture = SDL_CreateTexture((*service)->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, 160, 144))) {
         result = DMGL_ERROR("SDL_CreateTexture failed -- %s", SDL_GetError());
         goto exit;
     }
 
-    if(!(g_sdl.cursor = SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_CROSSHAIR))) {
+    if(!((*service)->cursor = SDL_CreateSystemCursor(SDL_SYSTEM_CURSOR_CROSSHAIR))) {
         result = DMGL_ERROR("SDL_CreateSystemCursor failed -- %s", SDL_GetError());
         goto exit;
     }
 
-    SDL_SetCursor(g_sdl.cursor);
+    SDL_SetCursor((*service)->cursor);
 
     for(size_t index = 0; index < sizeof(controller_map) / sizeof(*controller_map); ++index) {
 
@@ -163,22 +230,13 @@ dmgl_error_e dmgl_service_initialize(const dmgl_t *context, const char *title)
         }
     }
 
-    dmgl_service_clear();
+    dmgl_service_clear(*service);
 
 exit:
     return result;
 }
 
-void dmgl_service_pixel(dmgl_color_e color, uint8_t x, uint8_t y)
-{
-    const uint32_t colors[] = {
-        0xFF081820, 0xFF346856, 0xFF88C070, 0xFFE0F8D0,
-        };
-
-    g_sdl.pixel[(y * 160) + x] = colors[color];
-}
-
-dmgl_error_e dmgl_service_poll(void)
+dmgl_error_e dmgl_service_poll(dmgl_service_t *service)
 {
     SDL_Event event;
     dmgl_error_e result = DMGL_SUCCESS;
@@ -188,20 +246,20 @@ dmgl_error_e dmgl_service_poll(void)
         switch(event.type) {
             case SDL_CONTROLLERDEVICEADDED:
 
-                if(!g_sdl.controller && SDL_IsGameController(event.cdevice.which)) {
+                if(!service->controller && SDL_IsGameController(event.cdevice.which)) {
                     SDL_Joystick *joystick = NULL;
 
-                    if(!(g_sdl.controller = SDL_GameControllerOpen(event.cdevice.which))) {
+                    if(!(service->controller = SDL_GameControllerOpen(event.cdevice.which))) {
                         result = DMGL_ERROR("SDL_GameControllerOpen failed -- %s", SDL_GetError());
                         goto exit;
                     }
 
-                    if(!(joystick = SDL_GameControllerGetJoystick(g_sdl.controller))) {
+                    if(!(joystick = SDL_GameControllerGetJoystick(service->controller))) {
                         result = DMGL_ERROR("SDL_GameControllerGetJoystick failed -- %s", SDL_GetError());
                         goto exit;
                     }
 
-                    if((g_sdl.joystick = SDL_JoystickInstanceID(joystick)) == -1) {
+                    if((service->joystick = SDL_JoystickInstanceID(joystick)) == -1) {
                         result = DMGL_ERROR("SDL_JoystickInstanceID failed -- %s", SDL_GetError());
                         goto exit;
                     }
@@ -209,19 +267,22 @@ dmgl_error_e dmgl_service_poll(void)
                 break;
             case SDL_CONTROLLERDEVICEREMOVED:
 
-                if(g_sdl.controller && (g_sdl.joystick == event.cdevice.which)) {
-                    SDL_GameControllerClose(g_sdl.controller);
-                    g_sdl.controller = NULL;
+                if(service->controller && (service->joystick == event.cdevice.which)) {
+                    SDL_GameControllerClose(service->controller);
+                    service->controller = NULL;
                 }
                 break;
             case SDL_KEYUP:
 
-                if(!event.key.repeat) {
+                if(!event.key.repeat && (event.key.windowID == SDL_GetWindowID(service->window))) {
 
                     switch(event.key.keysym.scancode) {
                         case SDL_SCANCODE_R:
-                            dmgl_service_clear();
-                            dmgl_bus_reset();
+                            dmgl_service_clear(service);
+
+                            if((result = dmgl_bus_reset(service->bus)) != DMGL_SUCCESS) {
+                                goto exit;
+                            }
                             break;
                         default:
                             break;
@@ -231,6 +292,13 @@ dmgl_error_e dmgl_service_poll(void)
             case SDL_QUIT:
                 result = DMGL_COMPLETE;
                 goto exit;
+            case SDL_WINDOWEVENT:
+
+                if((event.window.event == SDL_WINDOWEVENT_CLOSE) && (event.window.windowID == SDL_GetWindowID(service->window))) {
+                    result = DMGL_COMPLETE;
+                    goto exit;
+                }
+                break;
             default:
                 break;
         }
@@ -240,62 +308,90 @@ exit:
     return result;
 }
 
-dmgl_error_e dmgl_service_sync(void)
+dmgl_error_e dmgl_service_sync(dmgl_service_t *service)
 {
     uint32_t elapsed;
     dmgl_error_e result = DMGL_SUCCESS;
 
-    if(SDL_UpdateTexture(g_sdl.texture, NULL, g_sdl.pixel, 160 * sizeof(uint32_t))) {
-        result = DMGL_ERROR("SDL_UpdateTexture failed -- %s", SDL_GetError());
-        goto exit;
+    if(!service->speed.uncapped && ((elapsed = (SDL_GetTicks() - service->tick)) < service->speed.period)) {
+        SDL_Delay(service->speed.period - elapsed);
     }
 
-    if(SDL_RenderClear(g_sdl.renderer)) {
-        result = DMGL_ERROR("SDL_RenderClear failed -- %s", SDL_GetError());
-        goto exit;
-    }
+    service->tick = SDL_GetTicks();
 
-    if(SDL_RenderCopy(g_sdl.renderer, g_sdl.texture, NULL, NULL)) {
-        result = DMGL_ERROR("SDL_RenderCopy failed -- %s", SDL_GetError());
-        goto exit;
-    }
+    if(service->vsync || ((service->tick - service->present) >= (1000 / (float)60))) {
+
+        if(service->color) {
+            dmgl_pixel_expand(service->color, COLOR, service->pixel, 160 * 144);
+        }
+
+        if(SDL_UpdateTexture(service->texture, NULL, service->pixel, 160 * sizeof(uint32_t))) {
+            result = DMGL_ERROR("SDL_UpdateTexture failed -- %s", SDL_GetError());
+            goto exit;
+        }
+
+        if(SDL_RenderClear(service->renderer)) {
+            result = DMGL_ERROR("SDL_RenderClear failed -- %s", SDL_GetError());
+            goto exit;
+        }
+
+        if(SDL_RenderCopy(service->renderer, service->texture, NULL, NULL)) {
+            result = DMGL_ERROR("SDL_RenderCopy failed -- %s", SDL_GetError());
+            goto exit;
+        }
 
-    if((elapsed = (SDL_GetTicks() - g_sdl.tick)) < (1000 / (float)60)) {
-        SDL_Delay((1000 / (float)60) - elapsed);
+        SDL_RenderPresent(service->renderer);
+        service->present = service->tick;
     }
 
-    SDL_RenderPresent(g_sdl.renderer);
-    g_sdl.tick = SDL_GetTicks();
+    ++service->input.frame;
+    ++service->statistics.frame;
+
+    if((elapsed = (service->tick - service->statistics.tick)) >= 1000) {
+        char title[128] = {};
+        float rate = (service->statistics.frame * 1000.f) / elapsed;
+
+        snprintf(title, sizeof(title), "%s [%.01f FPS, %.02f MHz]", service->title, rate, (rate * DMGL_BUS_FRAME) / 1000000.f);
+        SDL_SetWindowTitle(service->window, title);
+        service->statistics.frame = 0;
+        service->statistics.tick = service->tick;
+    }
 
 exit:
     return result;
 }
 
-void dmgl_service_uninitialize(void)
+void dmgl_service_uninitialize(dmgl_service_t *service)
 {
 
-    if(g_sdl.controller) {
-        SDL_GameControllerClose(g_sdl.controller);
-    }
+    if(service) {
 
-    if(g_sdl.cursor) {
-        SDL_FreeCursor(g_sdl.cursor);
-    }
+        if(service->controller) {
+            SDL_GameControllerClose(service->controller);
+        }
 
-    if(g_sdl.texture) {
-        SDL_DestroyTexture(g_sdl.texture);
-    }
+        if(service->cursor) {
+            SDL_FreeCursor(service->cursor);
+        }
 
-    if(g_sdl.renderer) {
-        SDL_DestroyRenderer(g_sdl.renderer);
-    }
+        if(service->texture) {
+            SDL_DestroyTexture(service->texture);
+        }
 
-    if(g_sdl.window) {
-        SDL_DestroyWindow(g_sdl.window);
-    }
+        if(service->renderer) {
+            SDL_DestroyRenderer(service->renderer);
+        }
+
+        if(service->window) {
+            SDL_DestroyWindow(service->window);
+        }
+
+        if(service->initialized) {
+            SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER | SDL_INIT_VIDEO);
+        }
 
-    SDL_Quit();
-    memset(&g_sdl, 0, sizeof(g_sdl));
+        dmgl_buffer_free(service);
+    }
 }
 
 #ifdef __cplusplus
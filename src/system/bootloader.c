@@ -83,6 +83,21 @@ exit:
     return result;
 }
 
+const uint8_t *dmgl_bootloader_map(const dmgl_bootloader_t *bootloader, uint16_t address)
+{
+    const uint8_t *result = NULL;
+
+    switch(address) {
+        case 0x0000 ... 0x00FF:
+            result = bootloader->enabled ? &bootloader->data[address - 0x0000] : NULL;
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
 uint8_t dmgl_bootloader_read(const dmgl_bootloader_t *bootloader, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -26,6 +26,15 @@
 
 #include <cartridge.h>
 
+/*!
+ * @brief Cartridge RAM page index macro.
+ * @param[in] _INDEX_ RAM bank index
+ * @param[in] _ADDRESS_ Byte address, within RAM bank
+ * @return Cartridge RAM page index
+ */
+#define DMGL_CARTRIDGE_RAM_PAGE(_INDEX_, _ADDRESS_) \
+    (((_INDEX_) * ((8 * 1024) / DMGL_PAGE_LENGTH)) + ((_ADDRESS_) / DMGL_PAGE_LENGTH))
+
 static const size_t RAM_COUNT[] = { 1, 1, 1, 4, 16, 8, };                   /*!< Supported cartridge RAM count */
 
 static const size_t ROM_COUNT[] = { 2, 4, 8, 16, 32, 64, 128, 256, 512, };  /*!< Supported cartridge ROM count */
@@ -102,6 +111,38 @@ uint8_t dmgl_cartridge_checksum(const dmgl_cartridge_t *cartridge)
     return ((const dmgl_cartridge_header_t *)&cartridge->rom.bank[0][0x0100])->checksum;
 }
 
+bool dmgl_cartridge_fault(const dmgl_cartridge_t *cartridge)
+{
+    return cartridge->ram.fault;
+}
+
+dmgl_error_e dmgl_cartridge_fork(dmgl_cartridge_t *cartridge, const dmgl_cartridge_t *parent)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if((cartridge->ram.page = (dmgl_page_t **)dmgl_buffer_allocate(DMGL_CARTRIDGE_RAM_PAGE(parent->ram.count, 0) * sizeof(*cartridge->ram.page))) == NULL) {
+        result = DMGL_ERROR("Cartridge failed to allocate RAM banks -- %zu", parent->ram.count);
+        goto exit;
+    }
+
+    for(size_t index = 0; index < DMGL_CARTRIDGE_RAM_PAGE(parent->ram.count, 0); ++index) {
+        cartridge->ram.page[index] = dmgl_page_share(parent->ram.page[index]);
+    }
+
+    cartridge->ram.count = parent->ram.count;
+
+    if((cartridge->rom.bank = (const uint8_t **)dmgl_buffer_allocate(parent->rom.count * sizeof(*cartridge->rom.bank))) == NULL) {
+        result = DMGL_ERROR("Cartridge failed to allocate ROM banks -- %zu", parent->rom.count);
+        goto exit;
+    }
+
+    memcpy(cartridge->rom.bank, parent->rom.bank, parent->rom.count * sizeof(*cartridge->rom.bank));
+    cartridge->rom.count = parent->rom.count;
+
+exit:
+    return result;
+}
+
 dmgl_error_e dmgl_cartridge_initialize(dmgl_cartridge_t *cartridge, const uint8_t *data, size_t length)
 {
     size_t count, index;
@@ -115,22 +156,17 @@ dmgl_error_e dmgl_cartridge_initialize(dmgl_cartridge_t *cartridge, const uint8_
     header = (const dmgl_cartridge_header_t *)&data[0x0100];
     count = RAM_COUNT[header->ram];
 
-    if((cartridge->ram.bank = (uint8_t **)dmgl_buffer_allocate(count * sizeof(*cartridge->ram.bank))) == NULL) {
+    if((cartridge->ram.page = (dmgl_page_t **)dmgl_buffer_allocate(DMGL_CARTRIDGE_RAM_PAGE(count, 0) * sizeof(*cartridge->ram.page))) == NULL) {
         result = DMGL_ERROR("Cartridge failed to allocate RAM banks -- %zu", count);
         goto exit;
     }
 
-    for(index = 0; index < count; ++index) {
-
-        if((cartridge->ram.bank[index] = (uint8_t *)dmgl_buffer_allocate(8 * 1024 * sizeof(*cartridge->ram.bank[index]))) == NULL) {
-            result = DMGL_ERROR("Cartridge failed to allocate RAM bank -- %zu", index);
-            goto exit;
-        }
-
-        memset(cartridge->ram.bank[index], 0xFF, 8 * 1024 * sizeof(*cartridge->ram.bank[index]));
+    if((result = dmgl_page_allocate_arena(cartridge->ram.page, DMGL_CARTRIDGE_RAM_PAGE(count, 0), 0xFF)) != DMGL_SUCCESS) {
+        goto exit;
     }
 
     cartridge->ram.count = count;
+
     count = ROM_COUNT[header->rom];
 
     if((cartridge->rom.bank = (const uint8_t **)dmgl_buffer_allocate(count * sizeof(*cartridge->rom.bank))) == NULL) {
@@ -148,27 +184,75 @@ exit:
     return result;
 }
 
+dmgl_error_e dmgl_cartridge_load(dmgl_cartridge_t *cartridge, const uint8_t *data)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(size_t index = 0; index < DMGL_CARTRIDGE_RAM_PAGE(cartridge->ram.count, 0); ++index, data += DMGL_PAGE_LENGTH) {
+        uint8_t *page;
+
+        if(!(page = dmgl_page_write(&cartridge->ram.page[index]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        memcpy(page, data, DMGL_PAGE_LENGTH);
+    }
+
+exit:
+    return result;
+}
+
 size_t dmgl_cartridge_ram_count(const dmgl_cartridge_t *cartridge)
 {
     return cartridge->ram.count;
 }
 
+const uint8_t *dmgl_cartridge_ram_map_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
+{
+    return &cartridge->ram.page[DMGL_CARTRIDGE_RAM_PAGE(index, address)]->data[address % DMGL_PAGE_LENGTH];
+}
+
+uint8_t *dmgl_cartridge_ram_map_write(dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
+{
+    dmgl_page_t *page = cartridge->ram.page[DMGL_CARTRIDGE_RAM_PAGE(index, address)];
+
+    return dmgl_page_shared(page) ? NULL : &page->data[address % DMGL_PAGE_LENGTH];
+}
+
 uint8_t dmgl_cartridge_ram_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
 {
-    return cartridge->ram.bank[index][address];
+    return cartridge->ram.page[DMGL_CARTRIDGE_RAM_PAGE(index, address)]->data[address % DMGL_PAGE_LENGTH];
 }
 
 void dmgl_cartridge_ram_write(dmgl_cartridge_t *cartridge, size_t index, uint16_t address, uint8_t value)
 {
-    cartridge->ram.bank[index][address] = value;
+    uint8_t *page;
+
+    if((page = dmgl_page_write(&cartridge->ram.page[DMGL_CARTRIDGE_RAM_PAGE(index, address)]))) {
+        page[address % DMGL_PAGE_LENGTH] = value;
+    } else {
+        cartridge->ram.fault = true;
+    }
 }
 
-void dmgl_cartridge_reset(dmgl_cartridge_t *cartridge)
+dmgl_error_e dmgl_cartridge_reset(dmgl_cartridge_t *cartridge)
 {
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(size_t index = 0; index < DMGL_CARTRIDGE_RAM_PAGE(cartridge->ram.count, 0); ++index) {
+        uint8_t *page;
+
+        if(!(page = dmgl_page_write(&cartridge->ram.page[index]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
 
-    for(size_t index = 0; index < cartridge->ram.count; ++index) {
-        memset(cartridge->ram.bank[index], 0xFF, 8 * 1024 * sizeof(*cartridge->ram.bank[index]));
+        memset(page, 0xFF, DMGL_PAGE_LENGTH);
     }
+
+exit:
+    return result;
 }
 
 size_t dmgl_cartridge_rom_count(const dmgl_cartridge_t *cartridge)
@@ -176,11 +260,26 @@ size_t dmgl_cartridge_rom_count(const dmgl_cartridge_t *cartridge)
     return cartridge->rom.count;
 }
 
+const uint8_t *dmgl_cartridge_rom_map(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
+{
+    return &cartridge->rom.bank[index][address];
+}
+
 uint8_t dmgl_cartridge_rom_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
 {
     return cartridge->rom.bank[index][address];
 }
 
+size_t dmgl_cartridge_save(const dmgl_cartridge_t *cartridge, uint8_t *data)
+{
+
+    for(size_t index = 0; data && (index < DMGL_CARTRIDGE_RAM_PAGE(cartridge->ram.count, 0)); ++index, data += DMGL_PAGE_LENGTH) {
+        memcpy(data, cartridge->ram.page[index]->data, DMGL_PAGE_LENGTH);
+    }
+
+    return cartridge->ram.count * 8 * 1024;
+}
+
 const char *dmgl_cartridge_title(const dmgl_cartridge_t *cartridge)
 {
     return (const char *)((const dmgl_cartridge_header_t *)&cartridge->rom.bank[0][0x0100])->title;
@@ -207,13 +306,13 @@ void dmgl_cartridge_uninitialize(dmgl_cartridge_t *cartridge)
         dmgl_buffer_free(cartridge->rom.bank);
     }
 
-    if(cartridge->ram.bank) {
+    if(cartridge->ram.page) {
 
-        for(size_t index = 0; index < cartridge->ram.count; ++index) {
-            dmgl_buffer_free(cartridge->ram.bank[index]);
+        for(size_t index = 0; index < DMGL_CARTRIDGE_RAM_PAGE(cartridge->ram.count, 0); ++index) {
+            dmgl_page_free(cartridge->ram.page[index]);
         }
 
-        dmgl_buffer_free(cartridge->ram.bank);
+        dmgl_buffer_free(cartridge->ram.page);
     }
 
     memset(cartridge, 0, sizeof(*cartridge));
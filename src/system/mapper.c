@@ -30,17 +30,45 @@
 extern "C" {
 #endif /* __cplusplus */
 
+uint16_t dmgl_mapper_bank(const dmgl_mapper_t *mapper, uint16_t address)
+{
+    return mapper->handler.bank(mapper->context, address);
+}
+
 uint8_t dmgl_mapper_checksum(const dmgl_mapper_t *mapper)
 {
     return dmgl_cartridge_checksum(&mapper->cartridge);
 }
 
+bool dmgl_mapper_fault(const dmgl_mapper_t *mapper)
+{
+    return dmgl_cartridge_fault(&mapper->cartridge);
+}
+
+dmgl_error_e dmgl_mapper_fork(dmgl_mapper_t *mapper, const dmgl_mapper_t *parent)
+{
+    dmgl_error_e result;
+
+    if((result = dmgl_cartridge_fork(&mapper->cartridge, &parent->cartridge)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if((result = parent->handler.fork(parent->context, &mapper->context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    memcpy(&mapper->handler, &parent->handler, sizeof(parent->handler));
+
+exit:
+    return result;
+}
+
 dmgl_error_e dmgl_mapper_initialize(dmgl_mapper_t *mapper, const uint8_t *data, size_t length)
 {
     dmgl_error_e result;
     dmgl_cartridge_e type;
     const dmgl_mapper_handler_t handler[] = {
-        { dmgl_mbc0_initialize, dmgl_mbc0_read, dmgl_mbc0_reset, dmgl_mbc0_uninitialize, dmgl_mbc0_write, },
+        { dmgl_mbc0_bank, dmgl_mbc0_fork, dmgl_mbc0_initialize, dmgl_mbc0_map_read, dmgl_mbc0_map_write, dmgl_mbc0_read, dmgl_mbc0_reset, dmgl_mbc0_uninitialize, dmgl_mbc0_write, },
         };
 
     if((result = dmgl_cartridge_initialize(&mapper->cartridge, data, length)) != DMGL_SUCCESS) {
@@ -57,15 +85,36 @@ exit:
     return result;
 }
 
+dmgl_error_e dmgl_mapper_load(dmgl_mapper_t *mapper, const uint8_t *data)
+{
+    return dmgl_cartridge_load(&mapper->cartridge, data);
+}
+
+const uint8_t *dmgl_mapper_map_read(const dmgl_mapper_t *mapper, uint16_t address)
+{
+    return mapper->handler.map_read(&mapper->cartridge, mapper->context, address);
+}
+
+uint8_t *dmgl_mapper_map_write(dmgl_mapper_t *mapper, uint16_t address)
+{
+    return mapper->handler.map_write(&mapper->cartridge, mapper->context, address);
+}
+
 uint8_t dmgl_mapper_read(const dmgl_mapper_t *mapper, uint16_t address)
 {
     return mapper->handler.read(&mapper->cartridge, mapper->context, address);
 }
 
-void dmgl_mapper_reset(dmgl_mapper_t *mapper)
+dmgl_error_e dmgl_mapper_reset(dmgl_mapper_t *mapper)
 {
-    dmgl_cartridge_reset(&mapper->cartridge);
     mapper->handler.reset(mapper->context);
+
+    return dmgl_cartridge_reset(&mapper->cartridge);
+}
+
+size_t dmgl_mapper_save(const dmgl_mapper_t *mapper, uint8_t *data)
+{
+    return dmgl_cartridge_save(&mapper->cartridge, data);
 }
 
 const char *dmgl_mapper_title(const dmgl_mapper_t *mapper)
@@ -84,9 +133,9 @@ void dmgl_mapper_uninitialize(dmgl_mapper_t *mapper)
     memset(mapper, 0, sizeof(*mapper));
 }
 
-void dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value)
+bool dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value)
 {
-    mapper->handler.write(&mapper->cartridge, mapper->context, address, value);
+    return mapper->handler.write(&mapper->cartridge, mapper->context, address, value);
 }
 
 #ifdef __cplusplus
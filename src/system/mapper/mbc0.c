@@ -30,6 +30,18 @@
 extern "C" {
 #endif /* __cplusplus */
 
+uint16_t dmgl_mbc0_bank(const void *context, uint16_t address)
+{
+    return ((address >= 0x4000) && (address <= 0x7FFF)) ? 1 : 0;
+}
+
+dmgl_error_e dmgl_mbc0_fork(const void *context, void **fork)
+{
+    *fork = NULL;
+
+    return DMGL_SUCCESS;
+}
+
 dmgl_error_e dmgl_mbc0_initialize(const dmgl_cartridge_t *cartridge, void **context)
 {
     *context = NULL;
@@ -37,6 +49,42 @@ dmgl_error_e dmgl_mbc0_initialize(const dmgl_cartridge_t *cartridge, void **cont
     return DMGL_SUCCESS;
 }
 
+const uint8_t *dmgl_mbc0_map_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address)
+{
+    const uint8_t *result = NULL;
+
+    switch(address) {
+        case 0x0000 ... 0x3FFF:
+            result = dmgl_cartridge_rom_map(cartridge, 0, address - 0x0000);
+            break;
+        case 0x4000 ... 0x7FFF:
+            result = dmgl_cartridge_rom_map(cartridge, 1, address - 0x4000);
+            break;
+        case 0xA000 ... 0xBFFF:
+            result = dmgl_cartridge_ram_map_read(cartridge, 0, address - 0xA000);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+uint8_t *dmgl_mbc0_map_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address)
+{
+    uint8_t *result = NULL;
+
+    switch(address) {
+        case 0xA000 ... 0xBFFF:
+            result = dmgl_cartridge_ram_map_write(cartridge, 0, address - 0xA000);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
 uint8_t dmgl_mbc0_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -68,7 +116,7 @@ void dmgl_mbc0_uninitialize(void *context)
     return;
 }
 
-void dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value)
+bool dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value)
 {
 
     switch(address) {
@@ -78,6 +126,8 @@ void dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t addres
         default:
             break;
     }
+
+    return false;
 }
 
 #ifdef __cplusplus
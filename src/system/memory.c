@@ -30,11 +30,140 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*!
+ * @brief Decode memory tile from 2bpp planar data into color indices.
+ * @param[in,out] memory Pointer to memory subsystem context
+ * @param[in] tile Tile index [0-383]
+ */
+static void dmgl_memory_decode(dmgl_memory_t *memory, uint16_t tile)
+{
+    dmgl_pixel_decode(&memory->video[tile >> 4]->data[(tile & 15) * 16], memory->tile.index[tile]);
+    memory->tile.dirty[tile] = false;
+}
+
+/*!
+ * @brief Map memory pages to host pointers.
+ * @param[in,out] memory Pointer to memory subsystem context
+ */
+static void dmgl_memory_map(dmgl_memory_t *memory)
+{
+
+    for(uint32_t page = 0; page < 256; ++page) {
+        uint16_t address = page << 8;
+        const uint8_t *read = NULL;
+        uint8_t *write = NULL;
+
+        switch(address) {
+            case 0x0000 ... 0x00FF:
+
+                if(!(read = dmgl_bootloader_map(&memory->bootloader, address))) {
+                    read = dmgl_mapper_map_read(&memory->mapper, address);
+                }
+                break;
+            case 0x0100 ... 0x7FFF:
+            case 0xA000 ... 0xBFFF:
+                read = dmgl_mapper_map_read(&memory->mapper, address);
+                write = dmgl_mapper_map_write(&memory->mapper, address);
+                break;
+            case 0x8000 ... 0x97FF:
+                read = memory->video[(address - 0x8000) >> 8]->data;
+                break;
+            case 0x9800 ... 0x9FFF:
+                read = memory->video[(address - 0x8000) >> 8]->data;
+                write = dmgl_page_shared(memory->video[(address - 0x8000) >> 8]) ? NULL : memory->video[(address - 0x8000) >> 8]->data;
+                break;
+            case 0xC000 ... 0xDFFF:
+                read = memory->internal[(address - 0xC000) >> 8]->data;
+                write = dmgl_page_shared(memory->internal[(address - 0xC000) >> 8]) ? NULL : memory->internal[(address - 0xC000) >> 8]->data;
+                break;
+            case 0xE000 ... 0xFDFF:
+                read = memory->internal[(address - 0xE000) >> 8]->data;
+                write = dmgl_page_shared(memory->internal[(address - 0xE000) >> 8]) ? NULL : memory->internal[(address - 0xE000) >> 8]->data;
+                break;
+            default:
+                break;
+        }
+
+        memory->page.read[page] = read;
+        memory->page.write[page] = write;
+    }
+}
+
+/*!
+ * @brief Query writable memory page data, duplicating a shared page and remapping on first write.
+ * @param[in,out] memory Pointer to memory subsystem context
+ * @param[in,out] page Pointer to page pointer
+ * @param[in] address Byte address
+ * @return Pointer to writable page data on success, NULL otherwise
+ */
+static uint8_t *dmgl_memory_page(dmgl_memory_t *memory, dmgl_page_t **page, uint16_t address)
+{
+    uint8_t *result;
+    const dmgl_page_t *previous = *page;
+
+    if(!(result = dmgl_page_write(page))) {
+        memory->fault = true;
+    } else if((*page != previous) || ((address >= 0x9800) && !memory->page.write[address >> 8])) {
+        dmgl_memory_map(memory);
+    }
+
+    return result;
+}
+
+uint16_t dmgl_memory_bank(const dmgl_memory_t *memory, uint16_t address)
+{
+    uint16_t result = 0;
+
+    switch(address) {
+        case 0x0000 ... 0x00FF:
+
+            if(!dmgl_bootloader_enabled(&memory->bootloader)) {
+                result = dmgl_mapper_bank(&memory->mapper, address);
+            }
+            break;
+        case 0x0100 ... 0x7FFF:
+            result = dmgl_mapper_bank(&memory->mapper, address);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
 uint8_t dmgl_memory_checksum(const dmgl_memory_t *memory)
 {
     return dmgl_mapper_checksum(&memory->mapper);
 }
 
+bool dmgl_memory_fault(const dmgl_memory_t *memory)
+{
+    return memory->fault || dmgl_mapper_fault(&memory->mapper);
+}
+
+dmgl_error_e dmgl_memory_fork(dmgl_memory_t *memory, dmgl_memory_t *parent)
+{
+    dmgl_error_e result;
+
+    memcpy(memory, parent, sizeof(*memory));
+    memset(&memory->mapper, 0, sizeof(memory->mapper));
+
+    for(uint32_t page = 0; page < 0x20; ++page) {
+        memory->internal[page] = dmgl_page_share(parent->internal[page]);
+        memory->video[page] = dmgl_page_share(parent->video[page]);
+    }
+
+    if((result = dmgl_mapper_fork(&memory->mapper, &parent->mapper)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    dmgl_memory_map(memory);
+    dmgl_memory_map(parent);
+
+exit:
+    return result;
+}
+
 bool dmgl_memory_has_bootloader(const dmgl_memory_t *memory)
 {
     return dmgl_bootloader_enabled(&memory->bootloader);
@@ -52,12 +181,67 @@ dmgl_error_e dmgl_memory_initialize(dmgl_memory_t *memory, const dmgl_t *context
         goto exit;
     }
 
-    dmgl_memory_reset(memory);
+    if((result = dmgl_page_allocate_arena(memory->internal, 0x20, 0xFF)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if((result = dmgl_page_allocate_arena(memory->video, 0x20, 0xFF)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    result = dmgl_memory_reset(memory);
 
 exit:
     return result;
 }
 
+dmgl_error_e dmgl_memory_load(dmgl_memory_t *memory, const uint8_t *data)
+{
+    dmgl_error_e result;
+
+    if(*(data++)) {
+        dmgl_bootloader_reset(&memory->bootloader);
+    } else {
+        dmgl_bootloader_disable(&memory->bootloader);
+    }
+
+    memcpy(memory->high, data, sizeof(memory->high));
+    data += sizeof(memory->high);
+
+    for(uint32_t page = 0; page < 0x20; ++page, data += DMGL_PAGE_LENGTH) {
+        uint8_t *internal;
+
+        if(!(internal = dmgl_page_write(&memory->internal[page]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        memcpy(internal, data, DMGL_PAGE_LENGTH);
+    }
+
+    memcpy(memory->sprite, data, sizeof(memory->sprite));
+    data += sizeof(memory->sprite);
+
+    for(uint32_t page = 0; page < 0x20; ++page, data += DMGL_PAGE_LENGTH) {
+        uint8_t *video;
+
+        if(!(video = dmgl_page_write(&memory->video[page]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        memcpy(video, data, DMGL_PAGE_LENGTH);
+    }
+
+    result = dmgl_mapper_load(&memory->mapper, data);
+
+exit:
+    memset(memory->tile.dirty, true, sizeof(memory->tile.dirty));
+    dmgl_memory_map(memory);
+
+    return result;
+}
+
 uint8_t dmgl_memory_read(const dmgl_memory_t *memory, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -72,13 +256,13 @@ uint8_t dmgl_memory_read(const dmgl_memory_t *memory, uint16_t address)
             }
             break;
         case 0x8000 ... 0x9FFF:
-            result = memory->video[address - 0x8000];
+            result = memory->video[(address - 0x8000) >> 8]->data[address & 0xFF];
             break;
         case 0xC000 ... 0xDFFF:
-            result = memory->internal[address - 0xC000];
+            result = memory->internal[(address - 0xC000) >> 8]->data[address & 0xFF];
             break;
         case 0xE000 ... 0xFDFF:
-            result = memory->internal[address - 0xE000];
+            result = memory->internal[(address - 0xE000) >> 8]->data[address & 0xFF];
             break;
         case 0xFE00 ... 0xFE9F:
             result = memory->sprite[address - 0xFE00];
@@ -94,14 +278,75 @@ uint8_t dmgl_memory_read(const dmgl_memory_t *memory, uint16_t address)
     return result;
 }
 
-void dmgl_memory_reset(dmgl_memory_t *memory)
+dmgl_error_e dmgl_memory_reset(dmgl_memory_t *memory)
 {
+    dmgl_error_e result;
+
     dmgl_bootloader_reset(&memory->bootloader);
-    dmgl_mapper_reset(&memory->mapper);
     memset(memory->high, 0xFF, sizeof(*memory->high));
-    memset(memory->internal, 0xFF, sizeof(*memory->internal));
     memset(memory->sprite, 0xFF, sizeof(*memory->sprite));
-    memset(memory->video, 0xFF, sizeof(*memory->video));
+
+    if((result = dmgl_mapper_reset(&memory->mapper)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    for(uint32_t page = 0; page < 0x20; ++page) {
+        uint8_t *data;
+
+        if(!(data = dmgl_page_write(&memory->internal[page]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        memset(data, 0xFF, DMGL_PAGE_LENGTH);
+
+        if(!(data = dmgl_page_write(&memory->video[page]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        memset(data, 0xFF, DMGL_PAGE_LENGTH);
+    }
+
+exit:
+    memset(memory->tile.dirty, true, sizeof(memory->tile.dirty));
+    dmgl_memory_map(memory);
+
+    return result;
+}
+
+size_t dmgl_memory_save(const dmgl_memory_t *memory, uint8_t *data)
+{
+    size_t result = 1 + sizeof(memory->high) + (0x20 * DMGL_PAGE_LENGTH) + sizeof(memory->sprite) + (0x20 * DMGL_PAGE_LENGTH);
+
+    if(data) {
+        *(data++) = dmgl_bootloader_enabled(&memory->bootloader);
+        memcpy(data, memory->high, sizeof(memory->high));
+        data += sizeof(memory->high);
+
+        for(uint32_t page = 0; page < 0x20; ++page, data += DMGL_PAGE_LENGTH) {
+            memcpy(data, memory->internal[page]->data, DMGL_PAGE_LENGTH);
+        }
+
+        memcpy(data, memory->sprite, sizeof(memory->sprite));
+        data += sizeof(memory->sprite);
+
+        for(uint32_t page = 0; page < 0x20; ++page, data += DMGL_PAGE_LENGTH) {
+            memcpy(data, memory->video[page]->data, DMGL_PAGE_LENGTH);
+        }
+    }
+
+    return result + dmgl_mapper_save(&memory->mapper, data);
+}
+
+const uint8_t *dmgl_memory_tile(dmgl_memory_t *memory, uint16_t tile)
+{
+
+    if(memory->tile.dirty[tile]) {
+        dmgl_memory_decode(memory, tile);
+    }
+
+    return memory->tile.index[tile];
 }
 
 const char *dmgl_memory_title(const dmgl_memory_t *memory)
@@ -111,6 +356,12 @@ const char *dmgl_memory_title(const dmgl_memory_t *memory)
 
 void dmgl_memory_uninitialize(dmgl_memory_t *memory)
 {
+
+    for(uint32_t page = 0; page < 0x20; ++page) {
+        dmgl_page_free(memory->internal[page]);
+        dmgl_page_free(memory->video[page]);
+    }
+
     dmgl_mapper_uninitialize(&memory->mapper);
     dmgl_bootloader_uninitialize(&memory->bootloader);
     memset(memory, 0, sizeof(*memory));
@@ -118,16 +369,44 @@ void dmgl_memory_uninitialize(dmgl_memory_t *memory)
 
 void dmgl_memory_write(dmgl_memory_t *memory, uint16_t address, uint8_t value)
 {
+    uint8_t *data;
 
     switch(address) {
-        case 0x8000 ... 0x9FFF:
-            memory->video[address - 0x8000] = value;
+        case 0x0000 ... 0x7FFF:
+
+            if(dmgl_mapper_write(&memory->mapper, address, value)) {
+                dmgl_memory_map(memory);
+            }
+            break;
+        case 0x8000 ... 0x97FF:
+
+            if((data = dmgl_memory_page(memory, &memory->video[(address - 0x8000) >> 8], address))) {
+                data[address & 0xFF] = value;
+                memory->tile.dirty[(address - 0x8000) >> 4] = true;
+            }
+            break;
+        case 0x9800 ... 0x9FFF:
+
+            if((data = dmgl_memory_page(memory, &memory->video[(address - 0x8000) >> 8], address))) {
+                data[address & 0xFF] = value;
+            }
+            break;
+        case 0xA000 ... 0xBFFF:
+            dmgl_mapper_write(&memory->mapper, address, value);
+            memory->page.read[address >> 8] = dmgl_mapper_map_read(&memory->mapper, address & 0xFF00);
+            memory->page.write[address >> 8] = dmgl_mapper_map_write(&memory->mapper, address & 0xFF00);
             break;
         case 0xC000 ... 0xDFFF:
-            memory->internal[address - 0xC000] = value;
+
+            if((data = dmgl_memory_page(memory, &memory->internal[(address - 0xC000) >> 8], address))) {
+                data[address & 0xFF] = value;
+            }
             break;
         case 0xE000 ... 0xFDFF:
-            memory->internal[address - 0xE000] = value;
+
+            if((data = dmgl_memory_page(memory, &memory->internal[(address - 0xE000) >> 8], address))) {
+                data[address & 0xFF] = value;
+            }
             break;
         case 0xFE00 ... 0xFE9F:
             memory->sprite[address - 0xFE00] = value;
@@ -137,6 +416,7 @@ void dmgl_memory_write(dmgl_memory_t *memory, uint16_t address, uint8_t value)
             break;
         case 0xFF50:
             dmgl_bootloader_disable(&memory->bootloader);
+            dmgl_memory_map(memory);
             break;
         default:
             dmgl_mapper_write(&memory->mapper, address, value);
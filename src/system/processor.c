@@ -24,9 +24,40 @@
  * @brief Processor subsystem.
  */
 
+#if JIT && defined(_WIN64)
+#error "JIT requires the System V x86-64 calling convention"
+#endif /* JIT && _WIN64 */
+
+#if JIT && defined(__x86_64__)
+#define _DEFAULT_SOURCE
+
+#include <sys/mman.h>
+#endif /* JIT && __x86_64__ */
+
+#include <threads.h>
 #include <bus.h>
 #include <processor.h>
 
+#define DMGL_PROCESSOR_BLOCK_UNCACHEABLE 0x80000000   /*!< Processor block key flag, set if the block start cannot be decoded */
+
+#define DMGL_PROCESSOR_FLAG_CARRY 0x10         /*!< Processor carry flag (C) mask */
+#define DMGL_PROCESSOR_FLAG_HALF_CARRY 0x20    /*!< Processor half-carry flag (H) mask */
+#define DMGL_PROCESSOR_FLAG_SUBTRACT 0x40      /*!< Processor subtract flag (N) mask */
+#define DMGL_PROCESSOR_FLAG_ZERO 0x80          /*!< Processor zero flag (Z) mask */
+
+#if JIT && defined(__x86_64__)
+#define DMGL_PROCESSOR_JIT_BLOCK ((DMGL_PROCESSOR_BLOCK_LENGTH * 64) + 128) /*!< Processor JIT code length reserved per block, in bytes */
+#define DMGL_PROCESSOR_JIT_THRESHOLD 16                                       /*!< Processor JIT block execution count before compiling */
+
+/*!
+ * @brief Emit processor JIT code bytes macro.
+ * @param[in,out] _PROCESSOR_ Pointer to processor context
+ * @param[in] ... Code bytes
+ */
+#define DMGL_PROCESSOR_JIT_EMIT(_PROCESSOR_, ...) \
+    dmgl_processor_jit_emit(_PROCESSOR_, (const uint8_t []){ __VA_ARGS__ }, sizeof((const uint8_t []){ __VA_ARGS__ }))
+#endif /* JIT && __x86_64__ */
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -39,67 +70,169 @@ extern "C" {
 typedef bool (*dmgl_processor_instruction_cb)(dmgl_processor_t *processor);
 
 /*!
- * @brief Fetch processor byte at PC and increment PC.
+ * @struct dmgl_processor_operation_t
+ * @brief Processor pre-decoded instruction.
+ */
+typedef struct dmgl_processor_operation_s dmgl_processor_operation_t;
+
+/*!
+ * @brief Processor pre-decoded instruction callback, executing the whole instruction.
  * @param[in,out] processor Pointer to processor context
- * @return Byte value
+ * @param[in] operation Constant pointer to pre-decoded instruction
  */
-static uint8_t dmgl_processor_fetch(dmgl_processor_t *processor)
+typedef void (*dmgl_processor_operation_cb)(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation);
+
+/*!
+ * @struct dmgl_processor_operation_s
+ * @brief Processor pre-decoded instruction.
+ */
+struct dmgl_processor_operation_s {
+    dmgl_processor_operation_cb execute;    /*!< Instruction callback */
+
+    union {
+        const uint8_t *byte;                /*!< Byte operand pointer (register or immediate), NULL for (HL) */
+        dmgl_processor_register_t *word;    /*!< Word operand pointer (register pair) */
+    } operand;                              /*!< Resolved instruction operand */
+
+    uint16_t address;                       /*!< Instruction address */
+    uint8_t opcode;                         /*!< Instruction opcode */
+    uint8_t immediate;                      /*!< Instruction immediate byte */
+    uint8_t length;                         /*!< Instruction length, in bytes */
+    uint8_t cycle;                          /*!< Instruction length, in machine cycles */
+};
+
+#if JIT && defined(__x86_64__)
+
+/*!
+ * @brief Processor JIT code callback, executing a whole block.
+ * @param[in,out] processor Pointer to processor context
+ */
+typedef void (*dmgl_processor_jit_cb)(dmgl_processor_t *processor);
+#endif /* JIT && __x86_64__ */
+
+/*!
+ * @struct dmgl_processor_block_s
+ * @brief Processor pre-decoded block of straight-line instructions.
+ */
+struct dmgl_processor_block_s {
+    uint32_t key;                                                       /*!< Block key, keyed by ROM bank and address, flagged if uncacheable */
+    uint32_t count;                                                     /*!< Block instruction count, 0 if empty */
+    uint32_t cycle;                                                     /*!< Block length, in machine cycles */
+#if JIT && defined(__x86_64__)
+    dmgl_processor_jit_cb code;                                         /*!< Block JIT code, NULL if not compiled */
+    uint32_t hits;                                                      /*!< Block JIT execution count, toward the compile threshold */
+    bool compiled;                                                      /*!< Block JIT compiled flag, set once compilation was attempted */
+#endif /* JIT && __x86_64__ */
+    dmgl_processor_operation_t operation[DMGL_PROCESSOR_BLOCK_LENGTH];  /*!< Block instructions */
+};
+
+/*!
+ * @struct dmgl_processor_flag_t
+ * @brief Processor precomputed ALU flag tables, each producing the whole F register.
+ */
+typedef struct {
+    uint8_t add[2][256][256];   /*!< ADD/ADC flags, indexed by carry-in, A and operand */
+    uint8_t sub[2][256][256];   /*!< SUB/SBC/CP flags, indexed by carry-in, A and operand */
+    uint8_t logical_and[256];   /*!< AND flags, indexed by result */
+    uint8_t logical_or[256];    /*!< OR/XOR flags, indexed by result */
+    uint16_t daa[8][256];       /*!< DAA AF register, indexed by N/H/C flags and A */
+} dmgl_processor_flag_t;
+
+static dmgl_processor_flag_t FLAG = {};             /*!< Processor ALU flag tables */
+static once_flag FLAG_ONCE = ONCE_FLAG_INIT;        /*!< Processor ALU flag tables initialization flag */
+
+/*!
+ * @struct dmgl_processor_lanes_t
+ * @brief Processor 8-bit registers in structure-of-arrays layout, one lane per processor.
+ */
+typedef struct {
+    uint8_t byte[8][DMGL_PROCESSOR_LANES];  /*!< Registers, indexed by operand encoding (B, C, D, E, H, L, F, A), with F in the (HL) slot */
+} dmgl_processor_lanes_t;
+
+/*!
+ * @brief ADD value and carry-in to processor A register.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] value Byte value
+ * @param[in] carry Carry-in (0 for ADD, C for ADC)
+ */
+static inline void dmgl_processor_add(dmgl_processor_t *processor, uint8_t value, uint8_t carry)
 {
-    return dmgl_bus_read(processor->bank.pc.word++);
+    processor->bank.af.low = FLAG.add[carry][processor->bank.af.high][value];
+    processor->bank.af.high += value + carry;
 }
 
 /*!
- * @brief Pop processor byte from SP and increment SP.
+ * @brief AND processor A register with value.
  * @param[in,out] processor Pointer to processor context
- * @return Byte value
+ * @param[in] value Byte value
  */
-static uint8_t dmgl_processor_pop(dmgl_processor_t *processor)
+static inline void dmgl_processor_and(dmgl_processor_t *processor, uint8_t value)
 {
-    return dmgl_bus_read(processor->bank.sp.word++);
+    processor->bank.af.high &= value;
+    processor->bank.af.low = FLAG.logical_and[processor->bank.af.high];
 }
 
 /*!
- * @brief Decrement processor SP and Push byte to SP.
+ * @brief Compare value with processor A register.
  * @param[in,out] processor Pointer to processor context
  * @param[in] value Byte value
  */
-static void dmgl_processor_push(dmgl_processor_t *processor, uint8_t value)
+static inline void dmgl_processor_cp(dmgl_processor_t *processor, uint8_t value)
 {
-    dmgl_bus_write(--processor->bank.sp.word, value);
+    processor->bank.af.low = FLAG.sub[0][processor->bank.af.high][value];
 }
 
 /*!
- * @brief Execute processor AND instruction.
+ * @brief Decimal-adjust processor A register.
  * @param[in,out] processor Pointer to processor context
- * @return true on success, false otherwise
  */
-static bool dmgl_processor_instruction_and(dmgl_processor_t *processor)
+static inline void dmgl_processor_daa(dmgl_processor_t *processor)
+{
+    processor->bank.af.word = FLAG.daa[(processor->bank.af.low >> 4) & 7][processor->bank.af.high];
+}
+
+/*!
+ * @brief Fetch processor byte at PC and increment PC.
+ * @param[in,out] processor Pointer to processor context
+ * @return Byte value
+ */
+static uint8_t dmgl_processor_fetch(dmgl_processor_t *processor)
+{
+    return dmgl_bus_read(processor->bus, processor->bank.pc.word++);
+}
+
+/*!
+ * @brief Fetch processor ALU instruction operand, from a register, (HL) or an immediate byte.
+ * @param[in,out] processor Pointer to processor context
+ * @return true if the operand needs another cycle, false otherwise
+ */
+static bool dmgl_processor_fetch_operand(dmgl_processor_t *processor)
 {
     bool result = false;
 
     switch(processor->instruction.cycle) {
         case 0:
 
-            switch(processor->instruction.opcode) {
-                case 0xA0: /* B */
+            switch(processor->instruction.opcode & 0xC7) {
+                case 0x80: /* B */
                     processor->instruction.operand.low = processor->bank.bc.high;
                     break;
-                case 0xA1: /* C */
+                case 0x81: /* C */
                     processor->instruction.operand.low = processor->bank.bc.low;
                     break;
-                case 0xA2: /* D */
+                case 0x82: /* D */
                     processor->instruction.operand.low = processor->bank.de.high;
                     break;
-                case 0xA3: /* E */
+                case 0x83: /* E */
                     processor->instruction.operand.low = processor->bank.de.low;
                     break;
-                case 0xA4: /* H */
+                case 0x84: /* H */
                     processor->instruction.operand.low = processor->bank.hl.high;
                     break;
-                case 0xA5: /* L */
+                case 0x85: /* L */
                     processor->instruction.operand.low = processor->bank.hl.low;
                     break;
-                case 0xA7: /* A */
+                case 0x87: /* A */
                     processor->instruction.operand.low = processor->bank.af.high;
                     break;
                 default:
@@ -109,11 +242,11 @@ static bool dmgl_processor_instruction_and(dmgl_processor_t *processor)
             break;
         case 1:
 
-            switch(processor->instruction.opcode) {
-                case 0xA6: /* (HL) */
-                    processor->instruction.operand.low = dmgl_bus_read(processor->bank.hl.word);
+            switch(processor->instruction.opcode & 0xC7) {
+                case 0x86: /* (HL) */
+                    processor->instruction.operand.low = dmgl_bus_read(processor->bus, processor->bank.hl.word);
                     break;
-                case 0xE6: /* N */
+                case 0xC6: /* N */
                     processor->instruction.operand.low = dmgl_processor_fetch(processor);
                     break;
                 default:
@@ -124,12 +257,168 @@ static bool dmgl_processor_instruction_and(dmgl_processor_t *processor)
             break;
     }
 
-    if(!result) {
-        processor->bank.af.high &= processor->instruction.operand.low;
-        processor->bank.af.carry = false;
-        processor->bank.af.half_carry = true;
-        processor->bank.af.subtract = false;
-        processor->bank.af.zero = !processor->bank.af.high;
+    return result;
+}
+
+/*!
+ * @brief Initialize processor ALU flag tables.
+ */
+static void dmgl_processor_flag_initialize(void)
+{
+
+    for(uint32_t carry = 0; carry < 2; ++carry) {
+
+        for(uint32_t left = 0; left < 256; ++left) {
+
+            for(uint32_t right = 0; right < 256; ++right) {
+                uint32_t sum = left + right + carry, difference = left - right - carry;
+
+                FLAG.add[carry][left][right] = (!(sum & 0xFF) ? DMGL_PROCESSOR_FLAG_ZERO : 0)
+                    | ((((left & 0x0F) + (right & 0x0F) + carry) > 0x0F) ? DMGL_PROCESSOR_FLAG_HALF_CARRY : 0)
+                    | ((sum > 0xFF) ? DMGL_PROCESSOR_FLAG_CARRY : 0);
+                FLAG.sub[carry][left][right] = (!(difference & 0xFF) ? DMGL_PROCESSOR_FLAG_ZERO : 0) | DMGL_PROCESSOR_FLAG_SUBTRACT
+                    | (((left & 0x0F) < ((right & 0x0F) + carry)) ? DMGL_PROCESSOR_FLAG_HALF_CARRY : 0)
+                    | ((left < (right + carry)) ? DMGL_PROCESSOR_FLAG_CARRY : 0);
+            }
+        }
+    }
+
+    for(uint32_t value = 0; value < 256; ++value) {
+        FLAG.logical_and[value] = (!value ? DMGL_PROCESSOR_FLAG_ZERO : 0) | DMGL_PROCESSOR_FLAG_HALF_CARRY;
+        FLAG.logical_or[value] = !value ? DMGL_PROCESSOR_FLAG_ZERO : 0;
+    }
+
+    for(uint32_t flag = 0; flag < 8; ++flag) {
+        bool carry = flag & 1, half_carry = flag & 2, subtract = flag & 4;
+
+        for(uint32_t value = 0; value < 256; ++value) {
+            uint8_t result = value;
+            bool carry_out = carry;
+
+            if(!subtract) {
+
+                if(carry || (result > 0x99)) {
+                    result += 0x60;
+                    carry_out = true;
+                }
+
+                if(half_carry || ((result & 0x0F) > 0x09)) {
+                    result += 0x06;
+                }
+            } else {
+
+                if(carry) {
+                    result -= 0x60;
+                }
+
+                if(half_carry) {
+                    result -= 0x06;
+                }
+            }
+
+            FLAG.daa[flag][value] = (result << 8) | (!result ? DMGL_PROCESSOR_FLAG_ZERO : 0)
+                | (subtract ? DMGL_PROCESSOR_FLAG_SUBTRACT : 0) | (carry_out ? DMGL_PROCESSOR_FLAG_CARRY : 0);
+        }
+    }
+}
+
+/*!
+ * @brief OR processor A register with value.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] value Byte value
+ */
+static inline void dmgl_processor_or(dmgl_processor_t *processor, uint8_t value)
+{
+    processor->bank.af.high |= value;
+    processor->bank.af.low = FLAG.logical_or[processor->bank.af.high];
+}
+
+/*!
+ * @brief Pop processor byte from SP and increment SP.
+ * @param[in,out] processor Pointer to processor context
+ * @return Byte value
+ */
+static uint8_t dmgl_processor_pop(dmgl_processor_t *processor)
+{
+    return dmgl_bus_read(processor->bus, processor->bank.sp.word++);
+}
+
+/*!
+ * @brief Decrement processor SP and Push byte to SP.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] value Byte value
+ */
+static void dmgl_processor_push(dmgl_processor_t *processor, uint8_t value)
+{
+    dmgl_bus_write(processor->bus, --processor->bank.sp.word, value);
+}
+
+/*!
+ * @brief SUB value and carry-in from processor A register.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] value Byte value
+ * @param[in] carry Carry-in (0 for SUB, C for SBC)
+ */
+static inline void dmgl_processor_sub(dmgl_processor_t *processor, uint8_t value, uint8_t carry)
+{
+    processor->bank.af.low = FLAG.sub[carry][processor->bank.af.high][value];
+    processor->bank.af.high -= value + carry;
+}
+
+/*!
+ * @brief XOR processor A register with value.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] value Byte value
+ */
+static inline void dmgl_processor_xor(dmgl_processor_t *processor, uint8_t value)
+{
+    processor->bank.af.high ^= value;
+    processor->bank.af.low = FLAG.logical_or[processor->bank.af.high];
+}
+
+/*!
+ * @brief Execute processor ADC instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_adc(dmgl_processor_t *processor)
+{
+    bool result;
+
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_add(processor, processor->instruction.operand.low, processor->bank.af.carry);
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Execute processor ADD instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_add(dmgl_processor_t *processor)
+{
+    bool result;
+
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_add(processor, processor->instruction.operand.low, 0);
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Execute processor AND instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_and(dmgl_processor_t *processor)
+{
+    bool result;
+
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_and(processor, processor->instruction.operand.low);
     }
 
     return result;
@@ -149,6 +438,22 @@ static bool dmgl_processor_instruction_ccf(dmgl_processor_t *processor)
     return false;
 }
 
+/*!
+ * @brief Execute processor CP instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_cp(dmgl_processor_t *processor)
+{
+    bool result;
+
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_cp(processor, processor->instruction.operand.low);
+    }
+
+    return result;
+}
+
 /*!
  * @brief Execute processor CPL instruction.
  * @param[in,out] processor Pointer to processor context
@@ -163,6 +468,18 @@ static bool dmgl_processor_instruction_cpl(dmgl_processor_t *processor)
     return false;
 }
 
+/*!
+ * @brief Execute processor DAA instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_daa(dmgl_processor_t *processor)
+{
+    dmgl_processor_daa(processor);
+
+    return false;
+}
+
 /*!
  * @brief Execute processor DI instruction.
  * @param[in,out] processor Pointer to processor context
@@ -218,61 +535,10 @@ static bool dmgl_processor_instruction_nop(dmgl_processor_t *processor)
  */
 static bool dmgl_processor_instruction_or(dmgl_processor_t *processor)
 {
-    bool result = false;
-
-    switch(processor->instruction.cycle) {
-        case 0:
-
-            switch(processor->instruction.opcode) {
-                case 0xB0: /* B */
-                    processor->instruction.operand.low = processor->bank.bc.high;
-                    break;
-                case 0xB1: /* C */
-                    processor->instruction.operand.low = processor->bank.bc.low;
-                    break;
-                case 0xB2: /* D */
-                    processor->instruction.operand.low = processor->bank.de.high;
-                    break;
-                case 0xB3: /* E */
-                    processor->instruction.operand.low = processor->bank.de.low;
-                    break;
-                case 0xB4: /* H */
-                    processor->instruction.operand.low = processor->bank.hl.high;
-                    break;
-                case 0xB5: /* L */
-                    processor->instruction.operand.low = processor->bank.hl.low;
-                    break;
-                case 0xB7: /* A */
-                    processor->instruction.operand.low = processor->bank.af.high;
-                    break;
-                default:
-                    result = true;
-                    break;
-            }
-            break;
-        case 1:
-
-            switch(processor->instruction.opcode) {
-                case 0xB6: /* (HL) */
-                    processor->instruction.operand.low = dmgl_bus_read(processor->bank.hl.word);
-                    break;
-                case 0xF6: /* N */
-                    processor->instruction.operand.low = dmgl_processor_fetch(processor);
-                    break;
-                default:
-                    break;
-            }
-            break;
-        default:
-            break;
-    }
+    bool result;
 
-    if(!result) {
-        processor->bank.af.high |= processor->instruction.operand.low;
-        processor->bank.af.carry = false;
-        processor->bank.af.half_carry = false;
-        processor->bank.af.subtract = false;
-        processor->bank.af.zero = !processor->bank.af.high;
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_or(processor, processor->instruction.operand.low);
     }
 
     return result;
@@ -362,6 +628,22 @@ static bool dmgl_processor_instruction_push(dmgl_processor_t *processor)
     return result;
 }
 
+/*!
+ * @brief Execute processor SBC instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_sbc(dmgl_processor_t *processor)
+{
+    bool result;
+
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_sub(processor, processor->instruction.operand.low, processor->bank.af.carry);
+    }
+
+    return result;
+}
+
 /*!
  * @brief Execute processor SCF instruction.
  * @param[in,out] processor Pointer to processor context
@@ -389,6 +671,22 @@ static bool dmgl_processor_instruction_stop(dmgl_processor_t *processor)
     return false;
 }
 
+/*!
+ * @brief Execute processor SUB instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @return true on success, false otherwise
+ */
+static bool dmgl_processor_instruction_sub(dmgl_processor_t *processor)
+{
+    bool result;
+
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_sub(processor, processor->instruction.operand.low, 0);
+    }
+
+    return result;
+}
+
 /*!
  * @brief Execute processor XOR instruction.
  * @param[in,out] processor Pointer to processor context
@@ -396,66 +694,526 @@ static bool dmgl_processor_instruction_stop(dmgl_processor_t *processor)
  */
 static bool dmgl_processor_instruction_xor(dmgl_processor_t *processor)
 {
-    bool result = false;
+    bool result;
 
-    switch(processor->instruction.cycle) {
-        case 0:
+    if(!(result = dmgl_processor_fetch_operand(processor))) {
+        dmgl_processor_xor(processor, processor->instruction.operand.low);
+    }
 
-            switch(processor->instruction.opcode) {
-                case 0xA8: /* B */
-                    processor->instruction.operand.low = processor->bank.bc.high;
-                    break;
-                case 0xA9: /* C */
-                    processor->instruction.operand.low = processor->bank.bc.low;
-                    break;
-                case 0xAA: /* D */
-                    processor->instruction.operand.low = processor->bank.de.high;
-                    break;
-                case 0xAB: /* E */
-                    processor->instruction.operand.low = processor->bank.de.low;
-                    break;
-                case 0xAC: /* H */
-                    processor->instruction.operand.low = processor->bank.hl.high;
-                    break;
-                case 0xAD: /* L */
-                    processor->instruction.operand.low = processor->bank.hl.low;
-                    break;
-                case 0xAF: /* A */
-                    processor->instruction.operand.low = processor->bank.af.high;
-                    break;
-                default:
-                    result = true;
-                    break;
-            }
-            break;
-        case 1:
+    return result;
+}
 
-            switch(processor->instruction.opcode) {
-                case 0xAE: /* (HL) */
-                    processor->instruction.operand.low = dmgl_bus_read(processor->bank.hl.word);
-                    break;
-                case 0xEE: /* N */
-                    processor->instruction.operand.low = dmgl_processor_fetch(processor);
-                    break;
-                default:
-                    break;
-            }
+static const dmgl_processor_instruction_cb INSTRUCTION[] = {
+    /* 00 */
+    dmgl_processor_instruction_nop, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 08 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 10 */
+    dmgl_processor_instruction_stop, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 18 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 20 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, dmgl_processor_instruction_daa,
+    /* 28 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, dmgl_processor_instruction_cpl,
+    /* 30 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, dmgl_processor_instruction_scf,
+    /* 38 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, dmgl_processor_instruction_ccf,
+    /* 40 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 48 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 50 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 58 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 60 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 68 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 70 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, dmgl_processor_instruction_halt, NULL,
+    /* 78 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 80 */
+    dmgl_processor_instruction_add, dmgl_processor_instruction_add, dmgl_processor_instruction_add, dmgl_processor_instruction_add,
+    dmgl_processor_instruction_add, dmgl_processor_instruction_add, dmgl_processor_instruction_add, dmgl_processor_instruction_add,
+    /* 88 */
+    dmgl_processor_instruction_adc, dmgl_processor_instruction_adc, dmgl_processor_instruction_adc, dmgl_processor_instruction_adc,
+    dmgl_processor_instruction_adc, dmgl_processor_instruction_adc, dmgl_processor_instruction_adc, dmgl_processor_instruction_adc,
+    /* 90 */
+    dmgl_processor_instruction_sub, dmgl_processor_instruction_sub, dmgl_processor_instruction_sub, dmgl_processor_instruction_sub,
+    dmgl_processor_instruction_sub, dmgl_processor_instruction_sub, dmgl_processor_instruction_sub, dmgl_processor_instruction_sub,
+    /* 98 */
+    dmgl_processor_instruction_sbc, dmgl_processor_instruction_sbc, dmgl_processor_instruction_sbc, dmgl_processor_instruction_sbc,
+    dmgl_processor_instruction_sbc, dmgl_processor_instruction_sbc, dmgl_processor_instruction_sbc, dmgl_processor_instruction_sbc,
+    /* A0 */
+    dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and,
+    dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and,
+    /* A8 */
+    dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor,
+    dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor,
+    /* B0 */
+    dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or,
+    dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or,
+    /* B8 */
+    dmgl_processor_instruction_cp, dmgl_processor_instruction_cp, dmgl_processor_instruction_cp, dmgl_processor_instruction_cp,
+    dmgl_processor_instruction_cp, dmgl_processor_instruction_cp, dmgl_processor_instruction_cp, dmgl_processor_instruction_cp,
+    /* C0 */
+    NULL, dmgl_processor_instruction_pop, NULL, NULL,
+    NULL, dmgl_processor_instruction_push, dmgl_processor_instruction_add, NULL,
+    /* C8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, dmgl_processor_instruction_adc, NULL,
+    /* D0 */
+    NULL, dmgl_processor_instruction_pop, NULL, NULL,
+    NULL, dmgl_processor_instruction_push, dmgl_processor_instruction_sub, NULL,
+    /* D8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, dmgl_processor_instruction_sbc, NULL,
+    /* E0 */
+    NULL, dmgl_processor_instruction_pop, NULL, NULL,
+    NULL, dmgl_processor_instruction_push, dmgl_processor_instruction_and, NULL,
+    /* E8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, dmgl_processor_instruction_xor, NULL,
+    /* F0 */
+    NULL, dmgl_processor_instruction_pop, NULL, dmgl_processor_instruction_di,
+    NULL, dmgl_processor_instruction_push, dmgl_processor_instruction_or, NULL,
+    /* F8 */
+    NULL, NULL, NULL, dmgl_processor_instruction_ei,
+    NULL, NULL, dmgl_processor_instruction_cp, NULL,
+    };  /*!< Processor instructions */
+
+static const dmgl_processor_instruction_cb INSTRUCTION_EXTENDED[] = {
+    /* 00 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 08 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 10 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 18 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 20 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 28 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 30 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 38 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 40 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 48 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 50 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 58 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 60 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 68 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 70 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 78 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 80 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 88 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 90 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* 98 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* A0 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* A8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* B0 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* B8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* C0 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* C8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* D0 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* D8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* E0 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* E8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* F0 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    /* F8 */
+    NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL,
+    };  /*!< Processor extended instructions */
+
+/*!
+ * @brief Query processor pre-decoded byte operand.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ * @return Byte value
+ */
+static inline uint8_t dmgl_processor_operand(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    return operation->operand.byte ? *operation->operand.byte : dmgl_bus_read(processor->bus, processor->bank.hl.word);
+}
+
+/*!
+ * @brief Execute processor pre-decoded ADC instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_adc(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_add(processor, dmgl_processor_operand(processor, operation), processor->bank.af.carry);
+}
+
+/*!
+ * @brief Execute processor pre-decoded ADD instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_add(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_add(processor, dmgl_processor_operand(processor, operation), 0);
+}
+
+/*!
+ * @brief Execute processor pre-decoded AND instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_and(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_and(processor, dmgl_processor_operand(processor, operation));
+}
+
+/*!
+ * @brief Execute processor pre-decoded CP instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_cp(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_cp(processor, dmgl_processor_operand(processor, operation));
+}
+
+/*!
+ * @brief Execute processor pre-decoded single-cycle instruction through its instruction callback.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_instruction(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    INSTRUCTION[operation->opcode](processor);
+}
+
+/*!
+ * @brief Execute processor pre-decoded OR instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_or(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_or(processor, dmgl_processor_operand(processor, operation));
+}
+
+/*!
+ * @brief Execute processor pre-decoded POP instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_pop(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    operation->operand.word->low = dmgl_processor_pop(processor);
+
+    if(operation->opcode == 0xF1) {
+        operation->operand.word->low &= 0xF0;
+    }
+
+    operation->operand.word->high = dmgl_processor_pop(processor);
+}
+
+/*!
+ * @brief Execute processor pre-decoded PUSH instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_push(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_push(processor, operation->operand.word->high);
+    dmgl_processor_push(processor, operation->operand.word->low);
+}
+
+/*!
+ * @brief Execute processor pre-decoded SBC instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_sbc(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_sub(processor, dmgl_processor_operand(processor, operation), processor->bank.af.carry);
+}
+
+/*!
+ * @brief Execute processor pre-decoded SUB instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_sub(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_sub(processor, dmgl_processor_operand(processor, operation), 0);
+}
+
+/*!
+ * @brief Execute processor pre-decoded XOR instruction.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_operation_xor(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation)
+{
+    dmgl_processor_xor(processor, dmgl_processor_operand(processor, operation));
+}
+
+/*!
+ * @brief Decode processor instruction at address into a pre-decoded instruction, resolving its operand.
+ * @param[in,out] processor Pointer to processor context
+ * @param[out] operation Pointer to pre-decoded instruction
+ * @param[in] address Instruction address
+ * @return true if the instruction can be cached, false otherwise
+ */
+static bool dmgl_processor_decode(dmgl_processor_t *processor, dmgl_processor_operation_t *operation, uint16_t address)
+{
+    bool result = true;
+    uint8_t *byte[] = {
+        &processor->bank.bc.high, &processor->bank.bc.low, &processor->bank.de.high, &processor->bank.de.low,
+        &processor->bank.hl.high, &processor->bank.hl.low, NULL, &processor->bank.af.high,
+        };
+    const dmgl_processor_operation_cb alu[] = {
+        dmgl_processor_operation_add, dmgl_processor_operation_adc, dmgl_processor_operation_sub, dmgl_processor_operation_sbc,
+        dmgl_processor_operation_and, dmgl_processor_operation_xor, dmgl_processor_operation_or, dmgl_processor_operation_cp,
+        };
+    dmgl_processor_register_t *word[] = { &processor->bank.bc, &processor->bank.de, &processor->bank.hl, &processor->bank.af, };
+
+    memset(operation, 0, sizeof(*operation));
+    operation->address = address;
+    operation->opcode = dmgl_bus_read(processor->bus, address);
+    operation->length = 1;
+    operation->cycle = 1;
+
+    switch(operation->opcode) {
+        case 0x00: /* NOP */
+        case 0x27: /* DAA */
+        case 0x2F: /* CPL */
+        case 0x37: /* SCF */
+        case 0x3F: /* CCF */
+        case 0xF3: /* DI */
+            operation->execute = dmgl_processor_operation_instruction;
+            break;
+        case 0x80 ... 0xBF: /* ADD/ADC/SUB/SBC/AND/XOR/OR/CP R */
+            operation->execute = alu[(operation->opcode >> 3) & 7];
+            operation->operand.byte = byte[operation->opcode & 7];
+            operation->cycle = operation->operand.byte ? 1 : 2;
+            break;
+        case 0xC1: /* POP BC */
+        case 0xD1: /* POP DE */
+        case 0xE1: /* POP HL */
+        case 0xF1: /* POP AF */
+            operation->execute = dmgl_processor_operation_pop;
+            operation->operand.word = word[(operation->opcode >> 4) & 3];
+            operation->cycle = 3;
+            break;
+        case 0xC5: /* PUSH BC */
+        case 0xD5: /* PUSH DE */
+        case 0xE5: /* PUSH HL */
+        case 0xF5: /* PUSH AF */
+            operation->execute = dmgl_processor_operation_push;
+            operation->operand.word = word[(operation->opcode >> 4) & 3];
+            operation->cycle = 4;
+            break;
+        case 0xC6: /* ADD N */
+        case 0xCE: /* ADC N */
+        case 0xD6: /* SUB N */
+        case 0xDE: /* SBC N */
+        case 0xE6: /* AND N */
+        case 0xEE: /* XOR N */
+        case 0xF6: /* OR N */
+        case 0xFE: /* CP N */
+            operation->execute = alu[(operation->opcode >> 3) & 7];
+            operation->immediate = dmgl_bus_read(processor->bus, address + 1);
+            operation->operand.byte = &operation->immediate;
+            operation->length = 2;
+            operation->cycle = 2;
             break;
         default:
+            result = false;
             break;
     }
 
-    if(!result) {
-        processor->bank.af.high ^= processor->instruction.operand.low;
-        processor->bank.af.carry = false;
-        processor->bank.af.half_carry = false;
-        processor->bank.af.subtract = false;
-        processor->bank.af.zero = !processor->bank.af.high;
+    return result;
+}
+
+/*!
+ * @brief Query processor block at instruction address, decoding it on a cache miss.
+ * @param[in,out] processor Pointer to processor context
+ * @param[out] block Pointer to block pointer, NULL if the address cannot be cached
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_processor_block(dmgl_processor_t *processor, dmgl_processor_block_t **block)
+{
+    uint32_t key;
+    dmgl_processor_block_t *entry;
+    dmgl_error_e result = DMGL_SUCCESS;
+    uint16_t address = processor->instruction.address.word;
+
+    *block = NULL;
+
+    if((key = dmgl_bus_block(processor->bus, address)) == UINT32_MAX) {
+        goto exit;
+    }
+
+    if(!processor->block && !(processor->block = dmgl_buffer_allocate(DMGL_PROCESSOR_BLOCK_COUNT * sizeof(*processor->block)))) {
+        result = DMGL_ERROR("Processor block cache allocation failed -- %.02f KB (%zu bytes)",
+            (DMGL_PROCESSOR_BLOCK_COUNT * sizeof(*processor->block)) / 1024.f, DMGL_PROCESSOR_BLOCK_COUNT * sizeof(*processor->block));
+        goto exit;
+    }
+
+    entry = &processor->block[(address ^ ((key >> 16) << 6)) & (DMGL_PROCESSOR_BLOCK_COUNT - 1)];
+
+    if(entry->key == (key | DMGL_PROCESSOR_BLOCK_UNCACHEABLE)) {
+        goto exit;
+    }
+
+    if(!entry->count || (entry->key != key)) {
+        entry->key = key;
+        entry->cycle = 0;
+#if JIT && defined(__x86_64__)
+        entry->code = NULL;
+        entry->hits = 0;
+        entry->compiled = false;
+#endif /* JIT && __x86_64__ */
+
+        for(entry->count = 0; entry->count < DMGL_PROCESSOR_BLOCK_LENGTH; ++entry->count) {
+            dmgl_processor_operation_t *operation = &entry->operation[entry->count];
+
+            if(((address & 0xC000) != (processor->instruction.address.word & 0xC000))
+                    || !dmgl_processor_decode(processor, operation, address)
+                    || ((address + operation->length - 1) & 0xC000) != (address & 0xC000)) {
+                break;
+            }
+
+            address += operation->length;
+            entry->cycle += operation->cycle;
+
+            if(operation->execute == dmgl_processor_operation_push) {
+                ++entry->count;
+                break;
+            }
+        }
+
+        if(!entry->count) {
+            entry->key |= DMGL_PROCESSOR_BLOCK_UNCACHEABLE;
+        }
+    }
+
+    if(entry->count) {
+        *block = entry;
     }
 
+exit:
     return result;
 }
 
+/*!
+ * @brief Query processor at an instruction boundary, with no interrupt, halt or stop pending.
+ * @param[in] processor Constant pointer to processor context
+ * @return true if idle at an instruction boundary, false otherwise
+ */
+static inline bool dmgl_processor_boundary(const dmgl_processor_t *processor)
+{
+    return !processor->instruction.cycle && !processor->instruction.extended && !processor->interrupt.cycle
+        && !processor->halt.enabled && !processor->stop.enabled
+        && !(processor->interrupt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F));
+}
+
+/*!
+ * @brief Prefetch next processor instruction opcode at PC.
+ * @param[in,out] processor Pointer to processor context
+ */
+static void dmgl_processor_prefetch(dmgl_processor_t *processor)
+{
+    processor->instruction.address.word = processor->bank.pc.word;
+    processor->instruction.opcode = dmgl_processor_fetch(processor);
+    processor->instruction.extended = (processor->instruction.opcode == 0xCB);
+    processor->instruction.operand.word = 0x0000;
+
+    if(processor->halt.bug) {
+        processor->halt.bug = false;
+        --processor->bank.pc.word;
+    }
+
+    if(processor->interrupt.enabling) {
+
+        if(!--processor->interrupt.enabling) {
+            processor->interrupt.enabled = true;
+        }
+    }
+}
+
 /*!
  * @brief Execute processor instruction.
  * @param[in,out] processor Pointer to processor context
@@ -464,201 +1222,6 @@ static bool dmgl_processor_instruction_xor(dmgl_processor_t *processor)
 static dmgl_error_e dmgl_processor_instruction(dmgl_processor_t *processor)
 {
     dmgl_error_e result = DMGL_SUCCESS;
-    const dmgl_processor_instruction_cb instruction[] = {
-            /* 00 */
-            dmgl_processor_instruction_nop, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 08 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 10 */
-            dmgl_processor_instruction_stop, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 18 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 20 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 28 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, dmgl_processor_instruction_cpl,
-            /* 30 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, dmgl_processor_instruction_scf,
-            /* 38 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, dmgl_processor_instruction_ccf,
-            /* 40 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 48 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 50 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 58 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 60 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 68 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 70 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, dmgl_processor_instruction_halt, NULL,
-            /* 78 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 80 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 88 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 90 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 98 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* A0 */
-            dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and,
-            dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and, dmgl_processor_instruction_and,
-            /* A8 */
-            dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor,
-            dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor, dmgl_processor_instruction_xor,
-            /* B0 */
-            dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or,
-            dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or, dmgl_processor_instruction_or,
-            /* B8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* C0 */
-            NULL, dmgl_processor_instruction_pop, NULL, NULL,
-            NULL, dmgl_processor_instruction_push, NULL, NULL,
-            /* C8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* D0 */
-            NULL, dmgl_processor_instruction_pop, NULL, NULL,
-            NULL, dmgl_processor_instruction_push, NULL, NULL,
-            /* D8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* E0 */
-            NULL, dmgl_processor_instruction_pop, NULL, NULL,
-            NULL, dmgl_processor_instruction_push, dmgl_processor_instruction_and, NULL,
-            /* E8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, dmgl_processor_instruction_xor, NULL,
-            /* F0 */
-            NULL, dmgl_processor_instruction_pop, NULL, dmgl_processor_instruction_di,
-            NULL, dmgl_processor_instruction_push, dmgl_processor_instruction_or, NULL,
-            /* F8 */
-            NULL, NULL, NULL, dmgl_processor_instruction_ei,
-            NULL, NULL, NULL, NULL,
-        }, instruction_extended[] = {
-            /* 00 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 08 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 10 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 18 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 20 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 28 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 30 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 38 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 40 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 48 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 50 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 58 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 60 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 68 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 70 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 78 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 80 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 88 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 90 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* 98 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* A0 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* A8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* B0 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* B8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* C0 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* C8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* D0 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* D8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* E0 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* E8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* F0 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-            /* F8 */
-            NULL, NULL, NULL, NULL,
-            NULL, NULL, NULL, NULL,
-        };
 
     switch(processor->instruction.cycle) {
         case 0:
@@ -666,12 +1229,12 @@ static dmgl_error_e dmgl_processor_instruction(dmgl_processor_t *processor)
             if(processor->instruction.extended) {
                 processor->instruction.opcode = dmgl_processor_fetch(processor);
 
-                if(!instruction_extended[processor->instruction.opcode](processor)) {
+                if(!INSTRUCTION_EXTENDED[processor->instruction.opcode](processor)) {
                     processor->instruction.cycle = 0;
                 } else {
                     ++processor->instruction.cycle;
                 }
-            } else if(!instruction[processor->instruction.opcode](processor)) {
+            } else if(!INSTRUCTION[processor->instruction.opcode](processor)) {
                 processor->instruction.cycle = 0;
             } else {
                 ++processor->instruction.cycle;
@@ -681,12 +1244,12 @@ static dmgl_error_e dmgl_processor_instruction(dmgl_processor_t *processor)
 
             if(processor->instruction.extended) {
 
-                if(!instruction_extended[processor->instruction.opcode](processor)) {
+                if(!INSTRUCTION_EXTENDED[processor->instruction.opcode](processor)) {
                     processor->instruction.cycle = 0;
                 } else {
                     ++processor->instruction.cycle;
                 }
-            } else if(!instruction[processor->instruction.opcode](processor)) {
+            } else if(!INSTRUCTION[processor->instruction.opcode](processor)) {
                 processor->instruction.cycle = 0;
             } else {
                 ++processor->instruction.cycle;
@@ -694,23 +1257,16 @@ static dmgl_error_e dmgl_processor_instruction(dmgl_processor_t *processor)
             break;
     }
 
-    if(!processor->instruction.cycle) {
-        processor->instruction.address.word = processor->bank.pc.word;
-        processor->instruction.opcode = dmgl_processor_fetch(processor);
-        processor->instruction.extended = (processor->instruction.opcode == 0xCB);
-        processor->instruction.operand.word = 0x0000;
-
-        if(processor->halt.bug) {
-            processor->halt.bug = false;
-            --processor->bank.pc.word;
-        }
+#if PROFILE
+    ++processor->profile.cycle[processor->instruction.extended][processor->instruction.opcode];
 
-        if(processor->interrupt.enabling) {
+    if(!processor->instruction.cycle) {
+        ++processor->profile.count[processor->instruction.extended][processor->instruction.opcode];
+    }
+#endif /* PROFILE */
 
-            if(!--processor->interrupt.enabling) {
-                processor->interrupt.enabled = true;
-            }
-        }
+    if(!processor->instruction.cycle) {
+        dmgl_processor_prefetch(processor);
     }
 
     return result;
@@ -768,47 +1324,664 @@ static void dmgl_processor_interrupt(dmgl_processor_t *processor)
     }
 }
 
-dmgl_error_e dmgl_processor_clock(dmgl_processor_t *processor)
+/*!
+ * @brief Query processor pre-decoded instruction can run across lanes, touching only A, F and register or immediate operands.
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ * @return true if the instruction can run across lanes, false otherwise
+ */
+static bool dmgl_processor_lane(const dmgl_processor_operation_t *operation)
 {
-    dmgl_error_e result = DMGL_SUCCESS;
+    bool result = false;
+
+    switch(operation->opcode) {
+        case 0x00: /* NOP */
+        case 0x2F: /* CPL */
+        case 0x37: /* SCF */
+        case 0x3F: /* CCF */
+            result = true;
+            break;
+        case 0x80 ... 0xBF: /* ADD/ADC/SUB/SBC/AND/XOR/OR/CP R */
+        case 0xC6: /* ADD N */
+        case 0xCE: /* ADC N */
+        case 0xD6: /* SUB N */
+        case 0xDE: /* SBC N */
+        case 0xE6: /* AND N */
+        case 0xEE: /* XOR N */
+        case 0xF6: /* OR N */
+        case 0xFE: /* CP N */
+            result = (operation->operand.byte != NULL);
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Execute processor pre-decoded instruction across all lanes, branch-free so it vectorizes.
+ * @param[in,out] lanes Pointer to processor lanes
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ */
+static void dmgl_processor_lanes(dmgl_processor_lanes_t *lanes, const dmgl_processor_operation_t *operation)
+{
+    uint8_t alu = (operation->opcode >> 3) & 7, value[DMGL_PROCESSOR_LANES], *a = lanes->byte[7], *f = lanes->byte[6];
+
+    if(operation->operand.byte == &operation->immediate) {
+        memset(value, operation->immediate, sizeof(value));
+    } else {
+        memcpy(value, lanes->byte[operation->opcode & 7], sizeof(value));
+    }
+
+    switch(operation->opcode) {
+        case 0x2F: /* CPL */
+
+            for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                a[lane] = ~a[lane];
+                f[lane] |= 0x60;
+            }
+            break;
+        case 0x37: /* SCF */
+
+            for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                f[lane] = (f[lane] & 0x8F) | 0x10;
+            }
+            break;
+        case 0x3F: /* CCF */
+
+            for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                f[lane] = (f[lane] & 0x9F) ^ 0x10;
+            }
+            break;
+        case 0x80 ... 0xBF:
+        case 0xC6 ... 0xFE:
+
+            switch(alu) {
+                case 0: /* ADD */
+                case 1: /* ADC */
+
+                    for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                        uint16_t carry = (alu == 1) ? ((f[lane] >> 4) & 1) : 0, sum = a[lane] + value[lane] + carry;
+
+                        f[lane] = (((uint8_t)sum == 0) << 7) | ((((a[lane] & 0x0F) + (value[lane] & 0x0F) + carry) & 0x10) << 1)
+                            | ((sum >> 4) & 0x10);
+                        a[lane] = sum;
+                    }
+                    break;
+                case 2: /* SUB */
+                case 3: /* SBC */
+                case 7: /* CP */
+
+                    for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                        uint16_t carry = (alu == 3) ? ((f[lane] >> 4) & 1) : 0, difference = a[lane] - value[lane] - carry;
+
+                        f[lane] = (((uint8_t)difference == 0) << 7) | 0x40
+                            | (((uint16_t)((a[lane] & 0x0F) - (value[lane] & 0x0F) - carry) & 0x10) << 1) | ((difference >> 4) & 0x10);
+                        a[lane] = (alu == 7) ? a[lane] : difference;
+                    }
+                    break;
+                case 4: /* AND */
+
+                    for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                        a[lane] &= value[lane];
+                        f[lane] = ((a[lane] == 0) << 7) | 0x20;
+                    }
+                    break;
+                case 5: /* XOR */
+
+                    for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                        a[lane] ^= value[lane];
+                        f[lane] = (a[lane] == 0) << 7;
+                    }
+                    break;
+                case 6: /* OR */
+
+                    for(uint32_t lane = 0; lane < DMGL_PROCESSOR_LANES; ++lane) {
+                        a[lane] |= value[lane];
+                        f[lane] = (a[lane] == 0) << 7;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default: /* NOP */
+            break;
+    }
+}
+
+/*!
+ * @brief Retire processor pre-decoded instruction, advancing to the next instruction in its block.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] block Constant pointer to processor block
+ * @param[in] operation Constant pointer to retired pre-decoded instruction
+ */
+static inline void dmgl_processor_retire(dmgl_processor_t *processor, const dmgl_processor_block_t *block, const dmgl_processor_operation_t *operation)
+{
+#if PROFILE
+    processor->profile.cycle[0][operation->opcode] += operation->cycle;
+    ++processor->profile.count[0][operation->opcode];
+#endif /* PROFILE */
+
+    if((operation + 1) < &block->operation[block->count]) {
+        processor->bank.pc.word = operation[1].address + 1;
+        processor->instruction.address.word = operation[1].address;
+        processor->instruction.opcode = operation[1].opcode;
+
+        if(processor->interrupt.enabling) {
+
+            if(!--processor->interrupt.enabling) {
+                processor->interrupt.enabled = true;
+            }
+        }
+    } else {
+        processor->bank.pc.word = operation->address + operation->length;
+        dmgl_processor_prefetch(processor);
+    }
+}
+
+#if THREADED
 
-    if(processor->cycle == 0) {
+/*!
+ * @brief Execute processor block through threaded dispatch, one whole instruction per dispatch, until the cycle limit.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] block Constant pointer to processor block
+ * @param[in] limit Cycle limit, in clock cycles
+ * @return Cycles elapsed, in clock cycles
+ */
+static uint32_t dmgl_processor_execute(dmgl_processor_t *processor, const dmgl_processor_block_t *block, uint64_t limit)
+{
+    uint32_t result = 0;
+    const dmgl_processor_operation_t *operation = block->operation, *end = &block->operation[block->count];
+    static const void *const DISPATCH[] = {
+        [0x00 ... 0xFF] = &&exit,
+        [0x00] = &&nop, [0x27] = &&daa, [0x2F] = &&cpl, [0x37] = &&scf, [0x3F] = &&ccf,
+        [0x80 ... 0x87] = &&add, [0x88 ... 0x8F] = &&adc, [0x90 ... 0x97] = &&sub, [0x98 ... 0x9F] = &&sbc,
+        [0xA0 ... 0xA7] = &&and, [0xA8 ... 0xAF] = &&xor, [0xB0 ... 0xB7] = &&or, [0xB8 ... 0xBF] = &&cp,
+        [0xC1] = &&pop, [0xD1] = &&pop, [0xE1] = &&pop, [0xF1] = &&pop,
+        [0xC5] = &&push, [0xD5] = &&push, [0xE5] = &&push, [0xF5] = &&push,
+        [0xC6] = &&add, [0xCE] = &&adc, [0xD6] = &&sub, [0xDE] = &&sbc,
+        [0xE6] = &&and, [0xEE] = &&xor, [0xF3] = &&di, [0xF6] = &&or, [0xFE] = &&cp,
+        };  /*!< Processor threaded dispatch labels, indexed by opcode */
+
+/*!
+ * @brief Dispatch next processor pre-decoded instruction macro, stopping at the block end, cycle limit or a pending interrupt.
+ */
+#define DMGL_PROCESSOR_DISPATCH() \
+    if((operation == end) || ((result + (operation->cycle * 4)) > limit) \
+            || (processor->interrupt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F))) { \
+        goto exit; \
+    } \
+    goto *DISPATCH[operation->opcode]
+
+/*!
+ * @brief Retire processor pre-decoded instruction and dispatch the next one macro.
+ */
+#define DMGL_PROCESSOR_NEXT() \
+    result += operation->cycle * 4; \
+    dmgl_processor_retire(processor, block, operation++); \
+    DMGL_PROCESSOR_DISPATCH()
+
+    DMGL_PROCESSOR_DISPATCH();
+
+adc:
+    dmgl_processor_add(processor, dmgl_processor_operand(processor, operation), processor->bank.af.carry);
+    DMGL_PROCESSOR_NEXT();
+add:
+    dmgl_processor_add(processor, dmgl_processor_operand(processor, operation), 0);
+    DMGL_PROCESSOR_NEXT();
+and:
+    dmgl_processor_and(processor, dmgl_processor_operand(processor, operation));
+    DMGL_PROCESSOR_NEXT();
+ccf:
+    dmgl_processor_instruction_ccf(processor);
+    DMGL_PROCESSOR_NEXT();
+cp:
+    dmgl_processor_cp(processor, dmgl_processor_operand(processor, operation));
+    DMGL_PROCESSOR_NEXT();
+cpl:
+    dmgl_processor_instruction_cpl(processor);
+    DMGL_PROCESSOR_NEXT();
+daa:
+    dmgl_processor_daa(processor);
+    DMGL_PROCESSOR_NEXT();
+di:
+    dmgl_processor_instruction_di(processor);
+    DMGL_PROCESSOR_NEXT();
+nop:
+    DMGL_PROCESSOR_NEXT();
+or:
+    dmgl_processor_or(processor, dmgl_processor_operand(processor, operation));
+    DMGL_PROCESSOR_NEXT();
+pop:
+    dmgl_processor_operation_pop(processor, operation);
+    DMGL_PROCESSOR_NEXT();
+push:
+    dmgl_processor_operation_push(processor, operation);
+    DMGL_PROCESSOR_NEXT();
+sbc:
+    dmgl_processor_sub(processor, dmgl_processor_operand(processor, operation), processor->bank.af.carry);
+    DMGL_PROCESSOR_NEXT();
+scf:
+    dmgl_processor_instruction_scf(processor);
+    DMGL_PROCESSOR_NEXT();
+sub:
+    dmgl_processor_sub(processor, dmgl_processor_operand(processor, operation), 0);
+    DMGL_PROCESSOR_NEXT();
+xor:
+    dmgl_processor_xor(processor, dmgl_processor_operand(processor, operation));
+    DMGL_PROCESSOR_NEXT();
+
+#undef DMGL_PROCESSOR_NEXT
+#undef DMGL_PROCESSOR_DISPATCH
+
+exit:
+    return result;
+}
+#else
+
+/*!
+ * @brief Execute processor block, calling one instruction callback per instruction, until the cycle limit.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] block Constant pointer to processor block
+ * @param[in] limit Cycle limit, in clock cycles
+ * @return Cycles elapsed, in clock cycles
+ */
+static uint32_t dmgl_processor_execute(dmgl_processor_t *processor, const dmgl_processor_block_t *block, uint64_t limit)
+{
+    uint32_t result = 0;
 
-        if(processor->halt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F)) {
-            processor->halt.enabled = false;
+    for(const dmgl_processor_operation_t *operation = block->operation; operation < &block->operation[block->count]; ++operation) {
+
+        if(((result + (operation->cycle * 4)) > limit)
+                || (processor->interrupt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F))) {
+            break;
         }
 
-        if(!processor->instruction.cycle) {
+        operation->execute(processor, operation);
+        result += operation->cycle * 4;
+        dmgl_processor_retire(processor, block, operation);
+    }
 
-            if((processor->interrupt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F))
-                    || processor->interrupt.cycle) {
-                dmgl_processor_interrupt(processor);
-            } else if(!processor->halt.enabled && !processor->stop.enabled) {
+    return result;
+}
+#endif /* THREADED */
 
-                if((result = dmgl_processor_instruction(processor)) != DMGL_SUCCESS) {
-                    goto exit;
-                }
+#if JIT && defined(__x86_64__)
+
+/*!
+ * @brief Emit processor JIT code bytes.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] data Constant pointer to code bytes
+ * @param[in] length Code length, in bytes
+ */
+static void dmgl_processor_jit_emit(dmgl_processor_t *processor, const uint8_t *data, size_t length)
+{
+    memcpy(processor->jit.code + processor->jit.length, data, length);
+    processor->jit.length += length;
+}
+
+/*!
+ * @brief Emit processor JIT displacement, from the processor context (RDI) to a field inside it.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] field Constant pointer to processor context field
+ */
+static void dmgl_processor_jit_offset(dmgl_processor_t *processor, const void *field)
+{
+    int32_t offset = (const uint8_t *)field - (const uint8_t *)processor;
+
+    dmgl_processor_jit_emit(processor, (const uint8_t *)&offset, sizeof(offset));
+}
+
+/*!
+ * @brief Emit processor JIT code for an arithmetic instruction, on A (CL) and F (DL), through the ALU flag tables.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ * @param[in] host Host register holding the operand (R10-R15, as 2-7), 0 if not held in a host register
+ * @param[in] opcode x86-64 register/register opcode (ADD/ADC: 0x00, SUB/SBC/CP: 0x28)
+ * @param[in] carry Carry-in flag (ADC/SBC)
+ */
+static void dmgl_processor_jit_arithmetic(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation, uint8_t host,
+        uint8_t opcode, bool carry)
+{
+    uint64_t address = (uintptr_t)(opcode ? FLAG.sub : FLAG.add);
+
+    if(operation->operand.byte == &operation->immediate) {
+        DMGL_PROCESSOR_JIT_EMIT(processor, 0x41, 0xB8, operation->immediate, 0x00, 0x00, 0x00);          /* mov r8d, imm32 */
+    } else if(operation->operand.byte == &processor->bank.af.high) {
+        DMGL_PROCESSOR_JIT_EMIT(processor, 0x41, 0x89, 0xC8);                                           /* mov r8d, ecx */
+    }
+
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x89, 0xC8, 0xC1, 0xE0, 0x08, 0x44, 0x09, 0xC0 | (host << 3));   /* mov eax, ecx; shl eax, 8; or eax, r8d/host */
+
+    if(carry) {
+        DMGL_PROCESSOR_JIT_EMIT(processor, 0x41, 0x89, 0xD1, 0x41, 0xC1, 0xE9, 0x04, 0x41, 0x83, 0xE1, 0x01, /* mov r9d, edx; shr r9d, 4; and r9d, 1 */
+            0x44, 0x89, 0xCE, 0xC1, 0xE6, 0x10, 0x09, 0xF0);                                            /* mov esi, r9d; shl esi, 16; or eax, esi */
+    }
+
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x48, 0xBE);                                                     /* mov rsi, imm64 */
+    dmgl_processor_jit_emit(processor, (const uint8_t *)&address, sizeof(address));
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x0F, 0xB6, 0x14, 0x06);                                         /* movzx edx, byte [rsi + rax] */
+
+    if(operation->execute != dmgl_processor_operation_cp) {
+        DMGL_PROCESSOR_JIT_EMIT(processor, 0x44, opcode, 0xC1 | (host << 3));                           /* op cl, r8b/host */
+
+        if(carry) {
+            DMGL_PROCESSOR_JIT_EMIT(processor, 0x44, opcode, 0xC9);                                     /* op cl, r9b */
+        }
+    }
+}
+
+/*!
+ * @brief Query processor bank register held in a JIT host register across the block.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] host Host register (R10-R15, as 2-7)
+ * @return Pointer to bank register (B, C, D, E, H and L, in host register order)
+ */
+static uint8_t *dmgl_processor_jit_register(dmgl_processor_t *processor, uint8_t host)
+{
+    uint8_t *byte[] = {
+        &processor->bank.bc.high, &processor->bank.bc.low, &processor->bank.de.high, &processor->bank.de.low,
+        &processor->bank.hl.high, &processor->bank.hl.low,
+        };
+
+    return byte[host - 2];
+}
+
+/*!
+ * @brief Query processor JIT host register holding a bank register across the block.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operand Constant pointer to byte operand
+ * @return Host register (R10-R15, as 2-7) for B, C, D, E, H and L, 0 otherwise
+ */
+static uint8_t dmgl_processor_jit_host(dmgl_processor_t *processor, const uint8_t *operand)
+{
+    uint8_t result = 0;
+
+    for(uint8_t host = 2; host < 8; ++host) {
+
+        if(operand == dmgl_processor_jit_register(processor, host)) {
+            result = host;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Emit processor JIT code for a logical instruction, on A (CL) and F (DL).
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] operation Constant pointer to pre-decoded instruction
+ * @param[in] host Host register holding the operand (R10-R15, as 2-7), 0 if not held in a host register
+ * @param[in] opcode x86-64 register/register opcode (AND: 0x20, OR: 0x08, XOR: 0x30)
+ * @param[in] extension x86-64 immediate opcode extension (AND: 4, OR: 1, XOR: 6)
+ * @param[in] flag Flags set alongside zero (AND: H, otherwise none)
+ */
+static void dmgl_processor_jit_logical(dmgl_processor_t *processor, const dmgl_processor_operation_t *operation, uint8_t host,
+        uint8_t opcode, uint8_t extension, uint8_t flag)
+{
+
+    if(operation->operand.byte == &operation->immediate) {
+        DMGL_PROCESSOR_JIT_EMIT(processor, 0x80, 0xC1 | (extension << 3), operation->immediate);        /* op cl, imm8 */
+    } else if(operation->operand.byte == &processor->bank.af.high) {
+        DMGL_PROCESSOR_JIT_EMIT(processor, opcode, 0xC9);                                               /* op cl, cl */
+    } else {
+        DMGL_PROCESSOR_JIT_EMIT(processor, 0x44, opcode, 0xC1 | (host << 3));                           /* op cl, host */
+    }
+
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x0F, 0x94, 0xC0, 0xC0, 0xE0, 0x07, 0x0C, flag,                   /* sete al; shl al, 7; or al, flag */
+        0x88, 0xC2);                                                                                    /* mov dl, al */
+}
+
+/*!
+ * @brief Compile processor block into x86-64 code, keeping A, F and the B-L registers it reads in host registers across the block.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in] block Constant pointer to processor block
+ * @return Pointer to block code on success, NULL if the block accesses the bus or the code buffer can not be mapped or protected
+ */
+static dmgl_processor_jit_cb dmgl_processor_jit_compile(dmgl_processor_t *processor, const dmgl_processor_block_t *block)
+{
+    uint8_t used = 0;
+    dmgl_processor_jit_cb result = NULL;
+
+    for(uint32_t index = 0; index < block->count; ++index) {
+        const dmgl_processor_operation_t *operation = &block->operation[index];
+
+        if(((operation->execute != dmgl_processor_operation_instruction)
+                && (operation->execute != dmgl_processor_operation_add)
+                && (operation->execute != dmgl_processor_operation_adc)
+                && (operation->execute != dmgl_processor_operation_sub)
+                && (operation->execute != dmgl_processor_operation_sbc)
+                && (operation->execute != dmgl_processor_operation_and)
+                && (operation->execute != dmgl_processor_operation_xor)
+                && (operation->execute != dmgl_processor_operation_or)
+                && (operation->execute != dmgl_processor_operation_cp))
+                || ((operation->execute != dmgl_processor_operation_instruction) && !operation->operand.byte)
+                || (operation->opcode == 0x27)) {
+            goto exit;
+        }
+
+        if(operation->execute != dmgl_processor_operation_instruction) {
+            used |= 1 << dmgl_processor_jit_host(processor, operation->operand.byte);
+        }
+    }
+
+    if(!processor->jit.code) {
+
+        if((processor->jit.code = mmap(NULL, DMGL_PROCESSOR_JIT_LENGTH, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED) {
+            processor->jit.code = NULL;
+            processor->jit.disabled = true;
+            goto exit;
+        }
+    } else if(mprotect(processor->jit.code, DMGL_PROCESSOR_JIT_LENGTH, PROT_READ | PROT_WRITE)) {
+        processor->jit.disabled = true;
+        goto exit;
+    }
+
+    if((processor->jit.length + DMGL_PROCESSOR_JIT_BLOCK) > DMGL_PROCESSOR_JIT_LENGTH) {
+
+        for(uint32_t index = 0; index < DMGL_PROCESSOR_BLOCK_COUNT; ++index) {
+            processor->block[index].code = NULL;
+            processor->block[index].compiled = false;
+        }
+
+        processor->jit.length = 0;
+    }
+
+    result = (dmgl_processor_jit_cb)(processor->jit.code + processor->jit.length);
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x0F, 0xB6, 0x8F);                                               /* movzx ecx, byte [rdi + A] */
+    dmgl_processor_jit_offset(processor, &processor->bank.af.high);
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x0F, 0xB6, 0x97);                                               /* movzx edx, byte [rdi + F] */
+    dmgl_processor_jit_offset(processor, &processor->bank.af.low);
+
+    for(uint8_t host = 2; host < 8; ++host) {
+
+        if(used & (1 << host)) {
+
+            if(host >= 4) {
+                DMGL_PROCESSOR_JIT_EMIT(processor, 0x41, 0x50 | host);                                  /* push host (callee-saved) */
             }
-        } else if((result = dmgl_processor_instruction(processor)) != DMGL_SUCCESS) {
+
+            DMGL_PROCESSOR_JIT_EMIT(processor, 0x44, 0x0F, 0xB6, 0x87 | (host << 3));                   /* movzx host, byte [rdi + R] */
+            dmgl_processor_jit_offset(processor, dmgl_processor_jit_register(processor, host));
+        }
+    }
+
+    for(uint32_t index = 0; index < block->count; ++index) {
+        const dmgl_processor_operation_t *operation = &block->operation[index];
+        uint8_t host = dmgl_processor_jit_host(processor, operation->operand.byte);
+
+        if(operation->execute == dmgl_processor_operation_add) {
+            dmgl_processor_jit_arithmetic(processor, operation, host, 0x00, false);
+        } else if(operation->execute == dmgl_processor_operation_adc) {
+            dmgl_processor_jit_arithmetic(processor, operation, host, 0x00, true);
+        } else if(operation->execute == dmgl_processor_operation_sub) {
+            dmgl_processor_jit_arithmetic(processor, operation, host, 0x28, false);
+        } else if(operation->execute == dmgl_processor_operation_sbc) {
+            dmgl_processor_jit_arithmetic(processor, operation, host, 0x28, true);
+        } else if(operation->execute == dmgl_processor_operation_and) {
+            dmgl_processor_jit_logical(processor, operation, host, 0x20, 4, 0x20);
+        } else if(operation->execute == dmgl_processor_operation_xor) {
+            dmgl_processor_jit_logical(processor, operation, host, 0x30, 6, 0x00);
+        } else if(operation->execute == dmgl_processor_operation_or) {
+            dmgl_processor_jit_logical(processor, operation, host, 0x08, 1, 0x00);
+        } else if(operation->execute == dmgl_processor_operation_cp) {
+            dmgl_processor_jit_arithmetic(processor, operation, host, 0x28, false);
+        } else {
+
+            switch(operation->opcode) {
+                case 0x2F: /* CPL */
+                    DMGL_PROCESSOR_JIT_EMIT(processor, 0xF6, 0xD1, 0x80, 0xCA, 0x60);                   /* not cl; or dl, 0x60 */
+                    break;
+                case 0x37: /* SCF */
+                    DMGL_PROCESSOR_JIT_EMIT(processor, 0x80, 0xE2, 0x8F, 0x80, 0xCA, 0x10);             /* and dl, 0x8F; or dl, 0x10 */
+                    break;
+                case 0x3F: /* CCF */
+                    DMGL_PROCESSOR_JIT_EMIT(processor, 0x80, 0xE2, 0x9F, 0x80, 0xF2, 0x10);             /* and dl, 0x9F; xor dl, 0x10 */
+                    break;
+                case 0xF3: /* DI */
+                    DMGL_PROCESSOR_JIT_EMIT(processor, 0xC6, 0x87);                                     /* mov byte [rdi + enabled], 0 */
+                    dmgl_processor_jit_offset(processor, &processor->interrupt.enabled);
+                    DMGL_PROCESSOR_JIT_EMIT(processor, 0x00, 0xC6, 0x87);                               /* mov byte [rdi + enabling], 0 */
+                    dmgl_processor_jit_offset(processor, &processor->interrupt.enabling);
+                    DMGL_PROCESSOR_JIT_EMIT(processor, 0x00);
+                    break;
+                default: /* NOP */
+                    break;
+            }
+        }
+    }
+
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x88, 0x8F);                                                     /* mov byte [rdi + A], cl */
+    dmgl_processor_jit_offset(processor, &processor->bank.af.high);
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0x88, 0x97);                                                     /* mov byte [rdi + F], dl */
+    dmgl_processor_jit_offset(processor, &processor->bank.af.low);
+
+    for(uint8_t host = 7; host >= 4; --host) {
+
+        if(used & (1 << host)) {
+            DMGL_PROCESSOR_JIT_EMIT(processor, 0x41, 0x58 | host);                                      /* pop host (callee-saved) */
+        }
+    }
+
+    DMGL_PROCESSOR_JIT_EMIT(processor, 0xC3);                                                           /* ret */
+
+    if(mprotect(processor->jit.code, DMGL_PROCESSOR_JIT_LENGTH, PROT_READ | PROT_EXEC)) {
+        processor->jit.disabled = true;
+        result = NULL;
+    }
+
+exit:
+    return result;
+}
+
+/*!
+ * @brief Run processor block through its JIT code, compiling it once it ran DMGL_PROCESSOR_JIT_THRESHOLD times.
+ * @param[in,out] processor Pointer to processor context
+ * @param[in,out] block Pointer to processor block
+ * @param[in] limit Cycle limit, in clock cycles
+ * @param[out] cycle Cycles elapsed, in clock cycles
+ * @return true if the block ran, false if it must be interpreted
+ */
+static bool dmgl_processor_jit(dmgl_processor_t *processor, dmgl_processor_block_t *block, uint64_t limit, uint32_t *cycle)
+{
+    bool result = false;
+    const dmgl_processor_operation_t *operation = &block->operation[block->count - 1];
+
+    if(processor->jit.disabled || processor->interrupt.enabling || ((block->cycle * 4) > limit)) {
+        goto exit;
+    }
+
+    if(!block->compiled) {
+
+        if(++block->hits < DMGL_PROCESSOR_JIT_THRESHOLD) {
             goto exit;
         }
 
-        processor->cycle = 4;
+        block->code = dmgl_processor_jit_compile(processor, block);
+        block->compiled = true;
+    }
+
+    if(!block->code) {
+        goto exit;
+    }
+
+    block->code(processor);
+    *cycle = block->cycle * 4;
+#if PROFILE
+
+    for(uint32_t index = 0; index < block->count; ++index) {
+        processor->profile.cycle[0][block->operation[index].opcode] += block->operation[index].cycle;
+        ++processor->profile.count[0][block->operation[index].opcode];
+    }
+#endif /* PROFILE */
+
+    processor->bank.pc.word = operation->address + operation->length;
+    dmgl_processor_prefetch(processor);
+    result = true;
+
+exit:
+    return result;
+}
+#endif /* JIT && __x86_64__ */
+
+dmgl_error_e dmgl_processor_clock(dmgl_processor_t *processor)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(processor->halt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F)) {
+        processor->halt.enabled = false;
     }
 
-    --processor->cycle;
+    if(!processor->instruction.cycle) {
+
+        if((processor->interrupt.enabled && (processor->interrupt.flag.raw & processor->interrupt.enable.raw & 0x1F))
+                || processor->interrupt.cycle) {
+            dmgl_processor_interrupt(processor);
+        } else if(!processor->halt.enabled && !processor->stop.enabled) {
+
+            if((result = dmgl_processor_instruction(processor)) != DMGL_SUCCESS) {
+                goto exit;
+            }
+        }
+    } else if((result = dmgl_processor_instruction(processor)) != DMGL_SUCCESS) {
+        goto exit;
+    }
 
 exit:
     return result;
 }
 
-void dmgl_processor_initialize(dmgl_processor_t *processor, bool has_bootloader, uint8_t checksum)
+void dmgl_processor_fork(dmgl_processor_t *processor, dmgl_bus_t *bus)
 {
+    processor->bus = bus;
+    processor->block = NULL;
+#if JIT
+    processor->jit.code = NULL;
+    processor->jit.length = 0;
+#endif /* JIT */
+}
+
+void dmgl_processor_initialize(dmgl_processor_t *processor, dmgl_bus_t *bus, bool has_bootloader, uint8_t checksum)
+{
+    call_once(&FLAG_ONCE, dmgl_processor_flag_initialize);
+    processor->bus = bus;
     processor->checksum = checksum;
     processor->has_bootloader = has_bootloader;
     dmgl_processor_reset(processor);
 }
 
+size_t dmgl_processor_load(dmgl_processor_t *processor, const uint8_t *data)
+{
+    size_t result = sizeof(*processor) - offsetof(dmgl_processor_t, bank);
+
+    memcpy((uint8_t *)processor + offsetof(dmgl_processor_t, bank), data, result);
+
+    return result;
+}
+
 uint8_t dmgl_processor_read(const dmgl_processor_t *processor, uint16_t address)
 {
     uint8_t result = 0xFF;
@@ -843,15 +2016,147 @@ void dmgl_processor_reset(dmgl_processor_t *processor)
         processor->interrupt.flag.raw = 0xE1;
     }
 
-    processor->cycle = 3;
     processor->instruction.address.word = processor->bank.pc.word;
     processor->instruction.opcode = dmgl_processor_fetch(processor);
     processor->instruction.extended = (processor->instruction.opcode == 0xCB);
     processor->instruction.operand.word = 0x0000;
 }
 
+dmgl_error_e dmgl_processor_run(dmgl_processor_t *processor, uint64_t limit, uint32_t *cycle)
+{
+    dmgl_processor_block_t *block = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    *cycle = 0;
+
+    if(dmgl_processor_boundary(processor) && ((result = dmgl_processor_block(processor, &block)) != DMGL_SUCCESS)) {
+        goto exit;
+    }
+
+#if JIT && defined(__x86_64__)
+
+    if(block && dmgl_processor_jit(processor, block, limit, cycle)) {
+        block = NULL;
+    }
+#endif /* JIT && __x86_64__ */
+
+    if(block) {
+        *cycle = dmgl_processor_execute(processor, block, limit);
+    }
+
+    if(!*cycle) {
+
+        if((result = dmgl_processor_clock(processor)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        *cycle = 4;
+    }
+
+exit:
+    return result;
+}
+
+dmgl_error_e dmgl_processor_run_lanes(dmgl_processor_t **processor, uint32_t count, const uint64_t *limit, uint32_t *cycle)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t base = 0; base < count; base += DMGL_PROCESSOR_LANES) {
+        dmgl_processor_lanes_t lanes = {};
+        bool matched[DMGL_PROCESSOR_LANES] = {};
+        dmgl_processor_block_t *block = NULL;
+        uint32_t length = ((count - base) < DMGL_PROCESSOR_LANES) ? (count - base) : DMGL_PROCESSOR_LANES, match = 0;
+
+        if(dmgl_processor_boundary(processor[base]) && ((result = dmgl_processor_block(processor[base], &block)) != DMGL_SUCCESS)) {
+            goto exit;
+        }
+
+        for(uint32_t index = 0; block && (index < block->count); ++index) {
+
+            if(!dmgl_processor_lane(&block->operation[index])) {
+                block = NULL;
+            }
+        }
+
+        for(uint32_t lane = 0; block && (lane < length); ++lane) {
+            dmgl_processor_t *entry = processor[base + lane];
+
+            if((matched[lane] = dmgl_processor_boundary(entry) && !entry->interrupt.enabling && ((block->cycle * 4) <= limit[base + lane])
+                    && (dmgl_bus_block(entry->bus, entry->instruction.address.word) == block->key))) {
+                lanes.byte[0][lane] = entry->bank.bc.high;
+                lanes.byte[1][lane] = entry->bank.bc.low;
+                lanes.byte[2][lane] = entry->bank.de.high;
+                lanes.byte[3][lane] = entry->bank.de.low;
+                lanes.byte[4][lane] = entry->bank.hl.high;
+                lanes.byte[5][lane] = entry->bank.hl.low;
+                lanes.byte[6][lane] = entry->bank.af.low;
+                lanes.byte[7][lane] = entry->bank.af.high;
+                ++match;
+            }
+        }
+
+        if((match < 2) || (match < ((length + 1) / 2))) {
+            memset(matched, 0, sizeof(matched));
+        } else {
+
+            for(uint32_t index = 0; index < block->count; ++index) {
+                dmgl_processor_lanes(&lanes, &block->operation[index]);
+            }
+        }
+
+        for(uint32_t lane = 0; lane < length; ++lane) {
+            dmgl_processor_t *entry = processor[base + lane];
+
+            if(!matched[lane]) {
+
+                if((result = dmgl_processor_run(entry, limit[base + lane], &cycle[base + lane])) != DMGL_SUCCESS) {
+                    goto exit;
+                }
+
+                continue;
+            }
+
+            entry->bank.af.high = lanes.byte[7][lane];
+            entry->bank.af.low = lanes.byte[6][lane];
+#if PROFILE
+
+            for(uint32_t index = 0; index < block->count; ++index) {
+                entry->profile.cycle[0][block->operation[index].opcode] += block->operation[index].cycle;
+                ++entry->profile.count[0][block->operation[index].opcode];
+            }
+#endif /* PROFILE */
+
+            entry->bank.pc.word = block->operation[block->count - 1].address + block->operation[block->count - 1].length;
+            dmgl_processor_prefetch(entry);
+            cycle[base + lane] = block->cycle * 4;
+        }
+    }
+
+exit:
+    return result;
+}
+
+size_t dmgl_processor_save(const dmgl_processor_t *processor, uint8_t *data)
+{
+    size_t result = sizeof(*processor) - offsetof(dmgl_processor_t, bank);
+
+    if(data) {
+        memcpy(data, (const uint8_t *)processor + offsetof(dmgl_processor_t, bank), result);
+    }
+
+    return result;
+}
+
 void dmgl_processor_uninitialize(dmgl_processor_t *processor)
 {
+#if JIT && defined(__x86_64__)
+
+    if(processor->jit.code) {
+        munmap(processor->jit.code, DMGL_PROCESSOR_JIT_LENGTH);
+    }
+#endif /* JIT && __x86_64__ */
+
+    dmgl_buffer_free(processor->block);
     memset(processor, 0, sizeof(*processor));
 }
 
@@ -0,0 +1,410 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file video.c
+ * @brief Video subsystem.
+ */
+
+#include <service.h>
+#include <video.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Convert palette index to color.
+ * @param[in] palette Palette register value
+ * @param[in] index Palette index [0-3]
+ * @return Color type
+ */
+static inline uint8_t dmgl_video_color(uint8_t palette, uint8_t index)
+{
+    return DMGL_COLOR_WHITE - ((palette >> (index * 2)) & 3);
+}
+
+/*!
+ * @brief Set video subsystem line, updating line coincidence.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[in] y Line y-coordinate
+ */
+static void dmgl_video_line(dmgl_video_t *video, uint8_t y)
+{
+    video->line.y = y;
+
+    if((video->status.coincidence = (video->line.y == video->line.coincidence)) && video->status.coincidence_interrupt) {
+        dmgl_bus_interrupt(video->bus, DMGL_INTERRUPT_SCREEN);
+    }
+}
+
+/*!
+ * @brief Set video subsystem mode, raising mode interrupt if enabled.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[in] mode Video mode
+ */
+static void dmgl_video_mode(dmgl_video_t *video, dmgl_video_mode_e mode)
+{
+    video->status.mode = mode;
+
+    switch(mode) {
+        case DMGL_VIDEO_HBLANK:
+
+            if(video->status.hblank_interrupt) {
+                dmgl_bus_interrupt(video->bus, DMGL_INTERRUPT_SCREEN);
+            }
+            break;
+        case DMGL_VIDEO_VBLANK:
+            dmgl_bus_interrupt(video->bus, DMGL_INTERRUPT_VBLANK);
+
+            if(video->status.vblank_interrupt) {
+                dmgl_bus_interrupt(video->bus, DMGL_INTERRUPT_SCREEN);
+            }
+            break;
+        case DMGL_VIDEO_SEARCH:
+
+            if(video->status.search_interrupt) {
+                dmgl_bus_interrupt(video->bus, DMGL_INTERRUPT_SCREEN);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*!
+ * @brief Render video subsystem background or window tiles into line indices.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[out] index Pointer to line color indices
+ * @param[in] map Tile map address
+ * @param[in] x Starting line x-coordinate
+ * @param[in] column Starting tile map x-coordinate
+ * @param[in] row Tile map y-coordinate
+ */
+static void dmgl_video_render_tiles(dmgl_video_t *video, uint8_t *index, uint16_t map, uint8_t x, uint8_t column, uint8_t row)
+{
+    map += (row >> 3) << 5;
+
+    while(x < 160) {
+        const uint8_t *tile;
+        uint8_t id = dmgl_bus_read(video->bus, map + (column >> 3));
+
+        tile = dmgl_bus_tile(video->bus, video->control.background_data ? id : (256 + (int8_t)id)) + ((row & 7) * 8);
+
+        for(uint8_t offset = column & 7; (offset < 8) && (x < 160); ++offset, ++column, ++x) {
+            index[x] = tile[offset];
+        }
+    }
+}
+
+/*!
+ * @brief Render video subsystem objects into line pixels.
+ * @param[in,out] video Pointer to video subsystem context
+ * @param[in] index Constant pointer to line background color indices
+ * @param[out] pixel Pointer to line pixels
+ */
+static void dmgl_video_render_objects(dmgl_video_t *video, const uint8_t *index, uint8_t *pixel)
+{
+    uint8_t count = 0, height = video->control.object_size ? 16 : 8, object[10][4] = {};
+
+    for(uint8_t entry = 0; (entry < 40) && (count < 10); ++entry) {
+        int16_t row = video->line.y - (dmgl_bus_read(video->bus, 0xFE00 + (entry * 4)) - 16);
+
+        if((row >= 0) && (row < height)) {
+            uint8_t position = count++;
+
+            for(uint8_t offset = 0; offset < 4; ++offset) {
+                object[position][offset] = dmgl_bus_read(video->bus, 0xFE00 + (entry * 4) + offset);
+            }
+
+            for(; position && (object[position - 1][1] > object[position][1]); --position) {
+                uint8_t swap[4];
+
+                memcpy(swap, object[position - 1], sizeof(swap));
+                memcpy(object[position - 1], object[position], sizeof(swap));
+                memcpy(object[position], swap, sizeof(swap));
+            }
+        }
+    }
+
+    while(count--) {
+        const uint8_t *tile;
+        uint8_t attribute = object[count][3], id = object[count][2], row = video->line.y - (object[count][0] - 16);
+
+        if(attribute & 0x40) {
+            row = height - 1 - row;
+        }
+
+        if(height == 16) {
+            id = (id & 0xFE) | (row >> 3);
+        }
+
+        tile = dmgl_bus_tile(video->bus, id) + ((row & 7) * 8);
+
+        for(uint8_t offset = 0; offset < 8; ++offset) {
+            uint8_t color;
+            int16_t x = object[count][1] - 8 + offset;
+
+            if((x < 0) || (x >= 160)) {
+                continue;
+            }
+
+            if(!(color = tile[(attribute & 0x20) ? (7 - offset) : offset]) || ((attribute & 0x80) && index[x])) {
+                continue;
+            }
+
+            pixel[x] = dmgl_video_color(video->palette.object[(attribute >> 4) & 1], color);
+        }
+    }
+}
+
+/*!
+ * @brief Render video subsystem line.
+ * @param[in,out] video Pointer to video subsystem context
+ */
+static void dmgl_video_render(dmgl_video_t *video)
+{
+    uint8_t index[160] = {}, *pixel = video->pixel[video->line.y];
+
+    if(video->control.background_enabled) {
+        dmgl_video_render_tiles(video, index, video->control.background_map ? 0x9C00 : 0x9800, 0, video->scroll.x,
+            video->line.y + video->scroll.y);
+
+        if(video->control.window_enabled && (video->line.y >= video->window.y) && (video->window.x <= 166)) {
+            dmgl_video_render_tiles(video, index, video->control.window_map ? 0x9C00 : 0x9800, (video->window.x < 7) ? 0 : (video->window.x - 7),
+                (video->window.x < 7) ? (7 - video->window.x) : 0, video->window.line++);
+        }
+    }
+
+    for(uint8_t x = 0; x < 160; ++x) {
+        pixel[x] = dmgl_video_color(video->palette.background, index[x]);
+    }
+
+    if(video->control.object_enabled) {
+        dmgl_video_render_objects(video, index, pixel);
+    }
+}
+
+uint32_t dmgl_video_event(dmgl_video_t *video)
+{
+    uint32_t result = 0;
+
+    if(!video->control.enabled) {
+        goto exit;
+    }
+
+    switch(video->status.mode) {
+        case DMGL_VIDEO_SEARCH:
+            dmgl_video_mode(video, DMGL_VIDEO_TRANSFER);
+            result = 172;
+            break;
+        case DMGL_VIDEO_TRANSFER:
+            dmgl_video_render(video);
+            dmgl_video_mode(video, DMGL_VIDEO_HBLANK);
+            result = 204;
+            break;
+        case DMGL_VIDEO_HBLANK:
+            dmgl_video_line(video, video->line.y + 1);
+
+            if(video->line.y == 144) {
+                dmgl_video_mode(video, DMGL_VIDEO_VBLANK);
+                result = 456;
+            } else {
+                dmgl_video_mode(video, DMGL_VIDEO_SEARCH);
+                result = 80;
+            }
+            break;
+        case DMGL_VIDEO_VBLANK:
+
+            if(video->line.y == 153) {
+                video->window.line = 0;
+                dmgl_video_line(video, 0);
+                dmgl_video_mode(video, DMGL_VIDEO_SEARCH);
+                result = 80;
+            } else {
+                dmgl_video_line(video, video->line.y + 1);
+                result = 456;
+            }
+            break;
+        default:
+            break;
+    }
+
+exit:
+    return result;
+}
+
+void dmgl_video_initialize(dmgl_video_t *video, dmgl_bus_t *bus, bool has_bootloader)
+{
+    video->bus = bus;
+    video->has_bootloader = has_bootloader;
+    dmgl_video_reset(video);
+}
+
+size_t dmgl_video_load(dmgl_video_t *video, const uint8_t *data)
+{
+    size_t result = offsetof(dmgl_video_t, pixel) - offsetof(dmgl_video_t, control);
+
+    memcpy((uint8_t *)video + offsetof(dmgl_video_t, control), data, result);
+
+    return result;
+}
+
+uint8_t dmgl_video_read(const dmgl_video_t *video, uint16_t address)
+{
+    uint8_t result = 0xFF;
+
+    switch(address) {
+        case 0xFF40:
+            result = video->control.raw;
+            break;
+        case 0xFF41:
+            result = video->status.raw | 0x80;
+            break;
+        case 0xFF42:
+            result = video->scroll.y;
+            break;
+        case 0xFF43:
+            result = video->scroll.x;
+            break;
+        case 0xFF44:
+            result = video->line.y;
+            break;
+        case 0xFF45:
+            result = video->line.coincidence;
+            break;
+        case 0xFF46:
+            result = video->dma;
+            break;
+        case 0xFF47:
+            result = video->palette.background;
+            break;
+        case 0xFF48 ... 0xFF49:
+            result = video->palette.object[address - 0xFF48];
+            break;
+        case 0xFF4A:
+            result = video->window.y;
+            break;
+        case 0xFF4B:
+            result = video->window.x;
+            break;
+        default:
+            break;
+    }
+
+    return result;
+}
+
+void dmgl_video_reset(dmgl_video_t *video)
+{
+    video->control.raw = 0x00;
+    video->status.raw = 0x00;
+    video->dma = 0x00;
+    memset(&video->scroll, 0, sizeof(video->scroll));
+    memset(&video->line, 0, sizeof(video->line));
+    memset(&video->palette, 0, sizeof(video->palette));
+    memset(&video->window, 0, sizeof(video->window));
+    memset(video->pixel, DMGL_COLOR_WHITE, sizeof(video->pixel));
+
+    if(!video->has_bootloader) {
+        video->control.raw = 0x91;
+        video->palette.background = 0xFC;
+    }
+
+    dmgl_video_line(video, 0);
+    video->status.mode = video->control.enabled ? DMGL_VIDEO_SEARCH : DMGL_VIDEO_HBLANK;
+}
+
+size_t dmgl_video_save(const dmgl_video_t *video, uint8_t *data)
+{
+    size_t result = offsetof(dmgl_video_t, pixel) - offsetof(dmgl_video_t, control);
+
+    if(data) {
+        memcpy(data, (const uint8_t *)video + offsetof(dmgl_video_t, control), result);
+    }
+
+    return result;
+}
+
+void dmgl_video_uninitialize(dmgl_video_t *video)
+{
+    memset(video, 0, sizeof(*video));
+}
+
+void dmgl_video_write(dmgl_video_t *video, uint16_t address, uint8_t value)
+{
+
+    switch(address) {
+        case 0xFF40:
+
+            if(!video->control.enabled && (value & 0x80)) {
+                video->window.line = 0;
+                dmgl_video_line(video, 0);
+                dmgl_video_mode(video, DMGL_VIDEO_SEARCH);
+                dmgl_bus_schedule(video->bus, DMGL_EVENT_VIDEO, 80);
+            } else if(video->control.enabled && !(value & 0x80)) {
+                video->line.y = 0;
+                video->status.mode = DMGL_VIDEO_HBLANK;
+                memset(video->pixel, DMGL_COLOR_WHITE, sizeof(video->pixel));
+            }
+
+            video->control.raw = value;
+            break;
+        case 0xFF41:
+            video->status.raw = (video->status.raw & 0x07) | (value & 0x78);
+            break;
+        case 0xFF42:
+            video->scroll.y = value;
+            break;
+        case 0xFF43:
+            video->scroll.x = value;
+            break;
+        case 0xFF45:
+            video->line.coincidence = value;
+            video->status.coincidence = (video->line.y == video->line.coincidence);
+            break;
+        case 0xFF46:
+            video->dma = value;
+
+            for(uint16_t offset = 0; offset < 0xA0; ++offset) {
+                dmgl_bus_write(video->bus, 0xFE00 + offset, dmgl_bus_read(video->bus, (value << 8) + offset));
+            }
+            break;
+        case 0xFF47:
+            video->palette.background = value;
+            break;
+        case 0xFF48 ... 0xFF49:
+            video->palette.object[address - 0xFF48] = value;
+            break;
+        case 0xFF4A:
+            video->window.y = value;
+            break;
+        case 0xFF4B:
+            video->window.x = value;
+            break;
+        default:
+            break;
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
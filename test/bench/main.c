@@ -0,0 +1,617 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Host-side benchmark application.
+ */
+
+#include <time.h>
+#include <bus.h>
+#include <cartridge.h>
+#include <processor.h>
+#include <test.h>
+
+#define DMGL_BENCH_BATCH 16                     /*!< Instances per batch benchmark */
+#define DMGL_BENCH_CHECKSUM (2 * 1024 * 1024)   /*!< Checksum/hash buffer length, in bytes */
+#define DMGL_BENCH_FRAME 600                    /*!< Frames per frame benchmark */
+#define DMGL_BENCH_LOAD 4096                    /*!< Loads per cartridge load benchmark */
+#define DMGL_BENCH_PASS 64                      /*!< Passes per checksum/hash/lanes benchmark */
+#define DMGL_BENCH_READ (16 * 1024 * 1024)      /*!< Reads per bus read benchmark */
+
+/*!
+ * @struct dmgl_bench_region_t
+ * @brief Benchmark bus region.
+ */
+typedef struct {
+    const char *name;       /*!< Region name */
+    uint16_t begin;         /*!< Region begin address */
+    uint16_t end;           /*!< Region end address, inclusive */
+} dmgl_bench_region_t;
+
+/*!
+ * @struct dmgl_bench_t
+ * @brief Benchmark context.
+ */
+typedef struct {
+    dmgl_t context;          /*!< DMGL context, loading the synthetic cartridge */
+    uint8_t *data;           /*!< Scratch data */
+    uint8_t rom[32 * 1024];  /*!< Synthetic cartridge data */
+    dmgl_t program;          /*!< DMGL context, loading the synthetic program cartridge */
+    uint8_t code[32 * 1024]; /*!< Synthetic program cartridge data, of lockstep-capable instruction runs */
+    volatile uint64_t sink;  /*!< Result sink, keeps benchmarked calls from being optimized out */
+} dmgl_bench_t;
+
+static const dmgl_bench_region_t REGION[] = {
+    { "rom0", 0x0000, 0x3FFF, },
+    { "romx", 0x4000, 0x7FFF, },
+    { "vram", 0x8000, 0x9FFF, },
+    { "sram", 0xA000, 0xBFFF, },
+    { "wram", 0xC000, 0xDFFF, },
+    { "echo", 0xE000, 0xFDFF, },
+    { "oam", 0xFE00, 0xFE9F, },
+    { "io", 0xFF00, 0xFF7F, },
+    { "hram", 0xFF80, 0xFFFE, },
+    };                      /*!< Benchmark bus regions */
+
+static dmgl_bench_t g_bench = {};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Measure elapsed time.
+ * @param[in] begin Constant pointer to begin time
+ * @param[in] end Constant pointer to end time
+ * @return Elapsed time, in nanoseconds
+ */
+static double dmgl_bench_elapsed(const struct timespec *begin, const struct timespec *end)
+{
+    return ((end->tv_sec - begin->tv_sec) * 1000000000.0) + (end->tv_nsec - begin->tv_nsec);
+}
+
+/*!
+ * @brief Print benchmark result, as a CSV row.
+ * @param[in] name Constant pointer to benchmark name string
+ * @param[in] iterations Benchmark iterations
+ * @param[in] value Benchmark value
+ * @param[in] unit Constant pointer to benchmark unit string
+ */
+static void dmgl_bench_result(const char *name, uint64_t iterations, double value, const char *unit)
+{
+    fprintf(stdout, "%s,%lu,%.3f,%s\n", name, (unsigned long)iterations, value, unit);
+}
+
+/*!
+ * @brief Generate synthetic cartridge data.
+ * @param[out] data Pointer to cartridge data
+ * @param[in] length Cartridge data length, in bytes
+ * @param[in] rom Cartridge ROM type
+ * @param[in] ram Cartridge RAM type
+ */
+static void dmgl_bench_rom(uint8_t *data, size_t length, uint8_t rom, uint8_t ram)
+{
+    const uint8_t opcode[] = { 0x00, 0xA0, 0xA9, 0xB2, 0x2F, 0x37, 0x3F, 0xAF, 0xC5, 0xC1, };
+    dmgl_cartridge_header_t *header = (dmgl_cartridge_header_t *)&data[0x0100];
+
+    memset(data, 0x00, length);
+
+    for(size_t address = 0x0150; address < length; ++address) {
+        data[address] = opcode[(address - 0x0150) % (sizeof(opcode) / sizeof(*opcode))];
+    }
+
+    header->rom = rom;
+    header->ram = ram;
+    header->version = 0xE6;
+    header->checksum = dmgl_checksum(data, 0x0134, 0x014C);
+}
+
+/*!
+ * @brief Generate synthetic program cartridge data, of lockstep-capable instruction runs separated by EI, DAA, (HL) and DI.
+ * @param[out] data Pointer to cartridge data
+ * @param[in] length Cartridge data length, in bytes
+ */
+static void dmgl_bench_program(uint8_t *data, size_t length)
+{
+    const uint8_t opcode[] = {
+        0x80, 0x91, 0xA2, 0xB3, 0x88, 0x9D, 0xAC, 0xB8, 0x2F, 0x37, 0x3F, 0xC6, 0x12, 0xD6, 0x34, 0xEE,
+        0x5A, 0xCE, 0x07, 0xDE, 0x99, 0xFE, 0x40, 0x87, 0x00, 0x8F, 0x97, 0x9F, 0xA7, 0xBF, 0xE6, 0xF0,
+        0xF6, 0x0F, 0x84, 0x8B, 0x92, 0x99, 0xA8, 0xB1, 0xBA, 0x85, 0x81, 0x94,
+        };
+    const uint8_t separator[] = { 0xFB, 0x27, 0xB6, 0xF3, };
+    const size_t run = 4 * (sizeof(opcode) / sizeof(*opcode));
+
+    dmgl_bench_rom(data, length, 0, 0);
+
+    for(size_t address = 0x0150; address < length; ++address) {
+        size_t offset = (address - 0x0150) % (run + sizeof(separator));
+
+        data[address] = (offset < run) ? opcode[offset % (sizeof(opcode) / sizeof(*opcode))] : separator[offset - run];
+    }
+}
+
+/*!
+ * @brief Benchmark batch frame time per instance, through a batch reused across runs, on one and on four workers.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_batch(void)
+{
+    size_t length = 0;
+    uint8_t *state = NULL;
+    dmgl_batch_t *batch = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+    dmgl_instance_t *instance[DMGL_BENCH_BATCH] = {};
+    const char *name[] = { "batch_1", "batch_4", };
+    const unsigned workers[] = { 1, 4, };
+
+    for(uint32_t index = 0; index < DMGL_BENCH_BATCH; ++index) {
+
+        if((result = dmgl_instance_create(&instance[index], &g_bench.context)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+    }
+
+    length = dmgl_state_length(instance[0]);
+
+    if(!(state = dmgl_buffer_allocate(length))) {
+        result = DMGL_ERROR("Bench state allocation failed -- %zu bytes", length);
+        goto exit;
+    }
+
+    if((result = dmgl_state_save(instance[0], state, length)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    for(uint32_t index = 0; index < (sizeof(workers) / sizeof(*workers)); ++index) {
+        double elapsed = 0.0;
+
+        dmgl_batch_destroy(batch);
+        batch = NULL;
+
+        if((result = dmgl_batch_create(&batch, workers[index])) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        for(uint32_t frame = 0; frame < (DMGL_BENCH_FRAME / DMGL_BENCH_BATCH); ++frame) {
+            struct timespec begin, end;
+
+            timespec_get(&begin, TIME_UTC);
+
+            if((result = dmgl_batch_run(batch, instance, DMGL_BENCH_BATCH, 1)) != DMGL_SUCCESS) {
+                goto exit;
+            }
+
+            timespec_get(&end, TIME_UTC);
+            elapsed += dmgl_bench_elapsed(&begin, &end);
+
+            for(uint32_t entry = 0; entry < DMGL_BENCH_BATCH; ++entry) {
+
+                if((result = dmgl_state_load(instance[entry], state, length)) != DMGL_SUCCESS) {
+                    goto exit;
+                }
+            }
+        }
+
+        dmgl_bench_result(name[index], DMGL_BENCH_FRAME, elapsed / DMGL_BENCH_FRAME, "ns/frame");
+    }
+
+exit:
+    dmgl_batch_destroy(batch);
+    dmgl_buffer_free(state);
+
+    for(uint32_t index = 0; index < DMGL_BENCH_BATCH; ++index) {
+        dmgl_instance_destroy(instance[index]);
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Benchmark bus clock, per call and per cycle.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_bus_clock(void)
+{
+    uint8_t *state = NULL;
+    dmgl_bus_t *bus = NULL;
+    double elapsed = 0.0;
+    uint64_t calls = 0, cycles = 0;
+    dmgl_error_e result;
+
+    if((result = dmgl_bus_initialize(&bus, &g_bench.context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    if(!(state = dmgl_buffer_allocate(dmgl_bus_save(bus, NULL)))) {
+        result = DMGL_ERROR("Bench state allocation failed -- %zu bytes", dmgl_bus_save(bus, NULL));
+        goto exit;
+    }
+
+    dmgl_bus_save(bus, state);
+
+    for(uint32_t frame = 0; frame < DMGL_BENCH_FRAME; ++frame) {
+        struct timespec begin, end;
+        uint64_t cycle = dmgl_bus_cycle(bus);
+
+        timespec_get(&begin, TIME_UTC);
+
+        do {
+            ++calls;
+
+            if((result = dmgl_bus_clock(bus)) == DMGL_FAILURE) {
+                goto exit;
+            }
+        } while(result != DMGL_COMPLETE);
+
+        timespec_get(&end, TIME_UTC);
+        elapsed += dmgl_bench_elapsed(&begin, &end);
+        cycles += dmgl_bus_cycle(bus) - cycle;
+        dmgl_bus_load(bus, state);
+    }
+
+    result = DMGL_SUCCESS;
+    dmgl_bench_result("bus_clock", calls, elapsed / calls, "ns/call");
+    dmgl_bench_result("bus_clock_cycle", cycles, elapsed / cycles, "ns/cycle");
+
+exit:
+    dmgl_buffer_free(state);
+    dmgl_bus_uninitialize(bus);
+
+    return result;
+}
+
+/*!
+ * @brief Benchmark bus read, per region.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_bus_read(void)
+{
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result;
+
+    if((result = dmgl_bus_initialize(&bus, &g_bench.context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    for(size_t region = 0; region < (sizeof(REGION) / sizeof(*REGION)); ++region) {
+        char name[32];
+        struct timespec begin, end;
+        uint64_t reads = 0, value = 0;
+
+        timespec_get(&begin, TIME_UTC);
+
+        while(reads < DMGL_BENCH_READ) {
+
+            for(uint32_t address = REGION[region].begin; address <= REGION[region].end; ++address, ++reads) {
+                value += dmgl_bus_read(bus, address);
+            }
+        }
+
+        timespec_get(&end, TIME_UTC);
+        g_bench.sink += value;
+        snprintf(name, sizeof(name), "bus_read_%s", REGION[region].name);
+        dmgl_bench_result(name, reads, dmgl_bench_elapsed(&begin, &end) / reads, "ns/read");
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
+
+    return result;
+}
+
+/*!
+ * @brief Benchmark cartridge load, for the smallest and largest supported cartridges.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_cartridge_load(void)
+{
+    const struct {
+        const char *name;
+        uint8_t rom;
+        uint8_t ram;
+        size_t length;
+    } cartridge[] = {
+        { "cartridge_load_32k", 0, 0, 32 * 1024, },
+        { "cartridge_load_8m", 8, 4, 8 * 1024 * 1024, },
+        };
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(size_t index = 0; index < (sizeof(cartridge) / sizeof(*cartridge)); ++index) {
+        uint8_t *data;
+        struct timespec begin, end;
+
+        if(!(data = dmgl_buffer_allocate(cartridge[index].length))) {
+            result = DMGL_ERROR("Bench cartridge allocation failed -- %zu bytes", cartridge[index].length);
+            goto exit;
+        }
+
+        dmgl_bench_rom(data, cartridge[index].length, cartridge[index].rom, cartridge[index].ram);
+        timespec_get(&begin, TIME_UTC);
+
+        for(uint32_t load = 0; load < DMGL_BENCH_LOAD; ++load) {
+            dmgl_cartridge_t context = {};
+
+            if((result = dmgl_cartridge_initialize(&context, data, cartridge[index].length)) != DMGL_SUCCESS) {
+                dmgl_cartridge_uninitialize(&context);
+                dmgl_buffer_free(data);
+                goto exit;
+            }
+
+            dmgl_cartridge_uninitialize(&context);
+        }
+
+        timespec_get(&end, TIME_UTC);
+        dmgl_buffer_free(data);
+        dmgl_bench_result(cartridge[index].name, DMGL_BENCH_LOAD, dmgl_bench_elapsed(&begin, &end) / DMGL_BENCH_LOAD, "ns/load");
+    }
+
+exit:
+    return result;
+}
+
+/*!
+ * @brief Benchmark checksum and hash throughput.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_checksum(void)
+{
+    double elapsed;
+    struct timespec begin, end;
+    uint64_t value = 0;
+
+    for(size_t index = 0; index < DMGL_BENCH_CHECKSUM; ++index) {
+        g_bench.data[index] = index * 0x9D;
+    }
+
+    timespec_get(&begin, TIME_UTC);
+
+    for(uint32_t pass = 0; pass < DMGL_BENCH_PASS; ++pass) {
+        value += dmgl_checksum(g_bench.data, 0, DMGL_BENCH_CHECKSUM - 1);
+    }
+
+    timespec_get(&end, TIME_UTC);
+    elapsed = dmgl_bench_elapsed(&begin, &end);
+    dmgl_bench_result("checksum", DMGL_BENCH_PASS, (DMGL_BENCH_PASS * (double)DMGL_BENCH_CHECKSUM * 1000000000.0) / (elapsed * 1024.0 * 1024.0), "MB/s");
+    timespec_get(&begin, TIME_UTC);
+
+    for(uint32_t pass = 0; pass < DMGL_BENCH_PASS; ++pass) {
+        value += dmgl_hash(g_bench.data, DMGL_BENCH_CHECKSUM);
+    }
+
+    timespec_get(&end, TIME_UTC);
+    elapsed = dmgl_bench_elapsed(&begin, &end);
+    dmgl_bench_result("hash", DMGL_BENCH_PASS, (DMGL_BENCH_PASS * (double)DMGL_BENCH_CHECKSUM * 1000000000.0) / (elapsed * 1024.0 * 1024.0), "MB/s");
+    g_bench.sink += value;
+
+    return DMGL_SUCCESS;
+}
+
+/*!
+ * @brief Benchmark full-frame time, through the instance API.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_frame(void)
+{
+    size_t length;
+    uint8_t *state = NULL;
+    double elapsed = 0.0;
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result;
+
+    if((result = dmgl_instance_create(&instance, &g_bench.context)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    length = dmgl_state_length(instance);
+
+    if(!(state = dmgl_buffer_allocate(length))) {
+        result = DMGL_ERROR("Bench state allocation failed -- %zu bytes", length);
+        goto exit;
+    }
+
+    if((result = dmgl_state_save(instance, state, length)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    for(uint32_t frame = 0; frame < DMGL_BENCH_FRAME; ++frame) {
+        struct timespec begin, end;
+
+        timespec_get(&begin, TIME_UTC);
+
+        if((result = dmgl_instance_frame(instance)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+
+        timespec_get(&end, TIME_UTC);
+        elapsed += dmgl_bench_elapsed(&begin, &end);
+
+        if((result = dmgl_state_load(instance, state, length)) != DMGL_SUCCESS) {
+            goto exit;
+        }
+    }
+
+    dmgl_bench_result("frame", DMGL_BENCH_FRAME, elapsed / DMGL_BENCH_FRAME, "ns/frame");
+
+exit:
+    dmgl_buffer_free(state);
+    dmgl_instance_destroy(instance);
+
+    return result;
+}
+
+/*!
+ * @brief Benchmark processor clock, per machine cycle, through the synthetic program.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_processor_clock(void)
+{
+    dmgl_bus_t *bus = NULL;
+    double elapsed = 0.0;
+    uint64_t cycles = 0;
+    dmgl_processor_t processor = {};
+    dmgl_error_e result;
+
+    if((result = dmgl_bus_initialize(&bus, &g_bench.program)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    dmgl_processor_initialize(&processor, bus, false, 0x00);
+
+    for(uint32_t pass = 0; pass < DMGL_BENCH_PASS; ++pass) {
+        struct timespec begin, end;
+
+        dmgl_processor_reset(&processor);
+        timespec_get(&begin, TIME_UTC);
+
+        for(; processor.bank.pc.word < 0x7F00; ++cycles) {
+
+            if((result = dmgl_processor_clock(&processor)) != DMGL_SUCCESS) {
+                goto exit;
+            }
+        }
+
+        timespec_get(&end, TIME_UTC);
+        elapsed += dmgl_bench_elapsed(&begin, &end);
+    }
+
+    dmgl_bench_result("processor_clock", cycles, elapsed / cycles, "ns/M-cycle");
+
+exit:
+    dmgl_processor_uninitialize(&processor);
+    dmgl_bus_uninitialize(bus);
+
+    return result;
+}
+
+/*!
+ * @brief Benchmark processor lanes against processor run, per machine cycle, on identical lanes through the synthetic program.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_bench_processor_lanes(void)
+{
+    static dmgl_processor_t lane[DMGL_PROCESSOR_LANES] = {};
+    dmgl_bus_t *bus = NULL;
+    double elapsed[2] = {};
+    dmgl_processor_t *processor[DMGL_PROCESSOR_LANES] = {};
+    uint32_t cycle[DMGL_PROCESSOR_LANES] = {};
+    uint64_t limit[DMGL_PROCESSOR_LANES] = {}, cycles[2] = {};
+    dmgl_error_e result;
+
+    if((result = dmgl_bus_initialize(&bus, &g_bench.program)) != DMGL_SUCCESS) {
+        goto exit;
+    }
+
+    for(uint32_t index = 0; index < DMGL_PROCESSOR_LANES; ++index) {
+        dmgl_processor_initialize(&lane[index], bus, false, 0x00);
+        processor[index] = &lane[index];
+        limit[index] = 512;
+    }
+
+    for(uint32_t pass = 0; pass < DMGL_BENCH_PASS; ++pass) {
+        struct timespec begin, end;
+
+        for(uint32_t index = 0; index < DMGL_PROCESSOR_LANES; ++index) {
+            dmgl_processor_reset(&lane[index]);
+        }
+
+        timespec_get(&begin, TIME_UTC);
+
+        while(lane[0].bank.pc.word < 0x7F00) {
+
+            if(pass & 1) {
+
+                if((result = dmgl_processor_run_lanes(processor, DMGL_PROCESSOR_LANES, limit, cycle)) != DMGL_SUCCESS) {
+                    goto exit;
+                }
+            } else {
+
+                for(uint32_t index = 0; index < DMGL_PROCESSOR_LANES; ++index) {
+
+                    if((result = dmgl_processor_run(&lane[index], limit[index], &cycle[index])) != DMGL_SUCCESS) {
+                        goto exit;
+                    }
+                }
+            }
+
+            for(uint32_t index = 0; index < DMGL_PROCESSOR_LANES; ++index) {
+                cycles[pass & 1] += cycle[index] / 4;
+            }
+        }
+
+        timespec_get(&end, TIME_UTC);
+        elapsed[pass & 1] += dmgl_bench_elapsed(&begin, &end);
+    }
+
+    dmgl_bench_result("processor_run", cycles[0], elapsed[0] / cycles[0], "ns/M-cycle");
+    dmgl_bench_result("processor_lanes", cycles[1], elapsed[1] / cycles[1], "ns/M-cycle");
+
+exit:
+
+    for(uint32_t index = 0; index < DMGL_PROCESSOR_LANES; ++index) {
+        dmgl_processor_uninitialize(&lane[index]);
+    }
+
+    dmgl_bus_uninitialize(bus);
+
+    return result;
+}
+
+int main(void)
+{
+    const dmgl_test_cb benches[] = {
+        dmgl_bench_batch, dmgl_bench_bus_clock, dmgl_bench_bus_read, dmgl_bench_cartridge_load,
+        dmgl_bench_checksum, dmgl_bench_frame, dmgl_bench_processor_clock, dmgl_bench_processor_lanes,
+        };
+    int result = DMGL_SUCCESS;
+
+    if(!(g_bench.data = dmgl_buffer_allocate(DMGL_BENCH_CHECKSUM))) {
+        fprintf(stderr, "Bench data allocation failed -- %u bytes\n", DMGL_BENCH_CHECKSUM);
+        return DMGL_FAILURE;
+    }
+
+    dmgl_bench_rom(g_bench.rom, sizeof(g_bench.rom), 0, 0);
+    g_bench.context.cartridge.data = g_bench.rom;
+    g_bench.context.cartridge.length = sizeof(g_bench.rom);
+    g_bench.context.speed.uncapped = true;
+    dmgl_bench_program(g_bench.code, sizeof(g_bench.code));
+    g_bench.program.cartridge.data = g_bench.code;
+    g_bench.program.cartridge.length = sizeof(g_bench.code);
+    g_bench.program.speed.uncapped = true;
+    fprintf(stdout, "name,iterations,value,unit\n");
+
+    for(int index = 0; index < (sizeof(benches) / sizeof(*benches)); ++index) {
+
+        if(benches[index]() == DMGL_FAILURE) {
+            fprintf(stderr, "%s\n", dmgl_error());
+            result = DMGL_FAILURE;
+            break;
+        }
+    }
+
+    dmgl_buffer_free(g_bench.data);
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
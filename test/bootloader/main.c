@@ -197,6 +197,45 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test bootloader map.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bootloader_map(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_bootloader.bootloader.data = g_test_bootloader.data;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+
+        for(int enabled = false; enabled <= true; ++enabled) {
+            const uint8_t *expected = NULL;
+
+            g_test_bootloader.bootloader.enabled = enabled;
+
+            switch(address) {
+                case 0x0000 ... 0x00FF:
+                    expected = enabled ? &g_test_bootloader.data[address] : NULL;
+                    break;
+                default:
+                    break;
+            }
+
+            if(DMGL_ASSERT(dmgl_bootloader_map(&g_test_bootloader.bootloader, address) == expected)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test bootloader read.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -298,8 +337,8 @@ int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_bootloader_disable, dmgl_test_bootloader_enabled, dmgl_test_bootloader_initialize, dmgl_test_bootloader_read,
-        dmgl_test_bootloader_reset, dmgl_test_bootloader_uninitialize,
+        dmgl_test_bootloader_disable, dmgl_test_bootloader_enabled, dmgl_test_bootloader_initialize, dmgl_test_bootloader_map,
+        dmgl_test_bootloader_read, dmgl_test_bootloader_reset, dmgl_test_bootloader_uninitialize,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
@@ -0,0 +1,203 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Common buffer test application.
+ */
+
+#include <buffer.h>
+#include <test.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Test buffer allocate.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_buffer_allocate(void)
+{
+    uint8_t *buffer;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((buffer = dmgl_buffer_allocate(64)) != NULL)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < 64; ++index) {
+
+        if(DMGL_ASSERT(buffer[index] == 0)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    dmgl_buffer_free(buffer);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test buffer arena allocate.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_buffer_arena_allocate(void)
+{
+    dmgl_buffer_arena_t *arena;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT(((arena = dmgl_buffer_arena_allocate(256)) != NULL)
+            && (arena->reference == 1)
+            && (arena->length == 256)
+            && (arena->offset == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_buffer_arena_release(arena);
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test buffer arena claim.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_buffer_arena_claim(void)
+{
+    uint8_t *buffer[3] = {};
+    dmgl_buffer_arena_t *arena;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((arena = dmgl_buffer_arena_allocate(256)) != NULL)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT(((buffer[0] = dmgl_buffer_arena_claim(arena, 1)) == arena->data)
+            && ((buffer[1] = dmgl_buffer_arena_claim(arena, 128)) == &arena->data[_Alignof(max_align_t)])
+            && !((uintptr_t)buffer[1] % _Alignof(max_align_t))
+            && (dmgl_buffer_arena_claim(arena, 256) == NULL)
+            && (arena->reference == 3))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT(((buffer[2] = dmgl_buffer_arena_claim(arena, 256 - 128 - _Alignof(max_align_t))) != NULL)
+            && (arena->offset == arena->length)
+            && (dmgl_buffer_arena_claim(arena, 1) == NULL)
+            && (arena->reference == 4))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < 256; ++index) {
+
+        if(DMGL_ASSERT(arena->data[index] == 0)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+
+    for(size_t index = 0; arena && (index < 3); ++index) {
+
+        if(buffer[index]) {
+            dmgl_buffer_arena_release(arena);
+        }
+    }
+
+    if(arena) {
+        dmgl_buffer_arena_release(arena);
+    }
+
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test buffer arena release.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_buffer_arena_release(void)
+{
+    dmgl_buffer_arena_t *arena;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((arena = dmgl_buffer_arena_allocate(256)) != NULL)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_buffer_arena_claim(arena, 64);
+    dmgl_buffer_arena_claim(arena, 64);
+    dmgl_buffer_arena_release(arena);
+
+    if(DMGL_ASSERT(arena->reference == 2)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_buffer_arena_release(arena);
+
+    if(DMGL_ASSERT(arena->reference == 1)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_buffer_arena_release(arena);
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_buffer_allocate, dmgl_test_buffer_arena_allocate, dmgl_test_buffer_arena_claim, dmgl_test_buffer_arena_release,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
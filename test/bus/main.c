@@ -27,6 +27,7 @@
 #include <bus.h>
 #include <memory.h>
 #include <processor.h>
+#include <video.h>
 #include <test.h>
 
 /*!
@@ -35,21 +36,41 @@
  */
 typedef struct {
 
+    struct {
+        dmgl_error_e status;                /*!< Bus buffer status */
+    } buffer;                               /*!< Bus buffer */
+
+    struct {
+        const dmgl_histogram_t *histogram;  /*!< Bus histogram context */
+        dmgl_error_e status;                /*!< Bus histogram status */
+        uint32_t key;                       /*!< Bus histogram key */
+        uint32_t count;                     /*!< Bus histogram increment counter */
+        bool initialized;                   /*!< Bus histogram initialized flag */
+    } histogram;                            /*!< Bus histogram */
+
     struct {
         const dmgl_memory_t *memory;        /*!< Bus memory context */
         const dmgl_t *context;              /*!< Bus memory DMGL context */
+        const dmgl_memory_t *parent;        /*!< Bus memory parent context */
         const char *title;                  /*!< Bus memory title string */
         dmgl_error_e status;                /*!< Bus memory status */
         uint16_t address;                   /*!< Bus memory address */
+        uint16_t bank;                      /*!< Bus memory ROM bank */
         uint8_t value;                      /*!< Bus memory value */
         bool has_bootloader;                /*!< Bus memory bootloader flag */
         uint8_t checksum;                   /*!< Bus memory checksum */
+        uint8_t page[256];                  /*!< Bus memory page */
+        bool mapped;                        /*!< Bus memory mapped flag */
         bool initialized;                   /*!< Bus memory initialized flag */
         bool reset;                         /*!< Bus memory reset flag */
+        bool fault;                         /*!< Bus memory fault flag */
+        const uint8_t *state;               /*!< Bus memory state data */
+        size_t length;                      /*!< Bus memory state length */
     } memory;                               /*!< Bus memory */
 
     struct {
         const dmgl_processor_t *processor;  /*!< Bus processor context */
+        const dmgl_bus_t *bus;              /*!< Bus processor bus context */
         dmgl_error_e status;                /*!< Bus processor status */
         uint16_t address;                   /*!< Bus processor address */
         uint8_t value;                      /*!< Bus processor value */
@@ -58,7 +79,24 @@ typedef struct {
         bool initialized;                   /*!< Bus processor initialized flag */
         bool reset;                         /*!< Bus processor reset flag */
         bool clock;                         /*!< Bus processor clock flag */
+        uint32_t cycle;                     /*!< Bus processor clock counter */
+        const uint8_t *state;               /*!< Bus processor state data */
+        size_t length;                      /*!< Bus processor state length */
     } processor;                            /*!< Bus processor */
+
+    struct {
+        const dmgl_video_t *video;          /*!< Bus video context */
+        const dmgl_bus_t *bus;              /*!< Bus video bus context */
+        uint16_t address;                   /*!< Bus video address */
+        uint8_t value;                      /*!< Bus video value */
+        bool has_bootloader;                /*!< Bus video bootloader flag */
+        bool initialized;                   /*!< Bus video initialized flag */
+        bool reset;                         /*!< Bus video reset flag */
+        bool event;                         /*!< Bus video event flag */
+        uint32_t delay;                     /*!< Bus video event delay */
+        const uint8_t *state;               /*!< Bus video state data */
+        size_t length;                      /*!< Bus video state length */
+    } video;                                /*!< Bus video */
 } dmgl_test_bus_t;
 
 static dmgl_test_bus_t g_test_bus = {};     /*!< Bus test context */
@@ -67,6 +105,52 @@ static dmgl_test_bus_t g_test_bus = {};     /*!< Bus test context */
 extern "C" {
 #endif /* __cplusplus */
 
+void *dmgl_buffer_allocate(size_t length)
+{
+    return (g_test_bus.buffer.status == DMGL_SUCCESS) ? calloc(length, sizeof(uint8_t)) : NULL;
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+dmgl_error_e dmgl_histogram_increment(dmgl_histogram_t *histogram, uint32_t key)
+{
+    g_test_bus.histogram.histogram = histogram;
+    g_test_bus.histogram.key = key;
+    ++g_test_bus.histogram.count;
+
+    return g_test_bus.histogram.status;
+}
+
+dmgl_error_e dmgl_histogram_initialize(dmgl_histogram_t *histogram, size_t capacity)
+{
+    g_test_bus.histogram.histogram = histogram;
+    g_test_bus.histogram.initialized = (g_test_bus.histogram.status == DMGL_SUCCESS);
+
+    return g_test_bus.histogram.status;
+}
+
+void dmgl_histogram_uninitialize(dmgl_histogram_t *histogram)
+{
+    g_test_bus.histogram.histogram = histogram;
+    g_test_bus.histogram.initialized = false;
+}
+
+uint16_t dmgl_memory_bank(const dmgl_memory_t *memory, uint16_t address)
+{
+    g_test_bus.memory.memory = memory;
+    g_test_bus.memory.address = address;
+
+    return g_test_bus.memory.bank;
+}
+
 uint8_t dmgl_memory_checksum(const dmgl_memory_t *memory)
 {
     g_test_bus.memory.memory = memory;
@@ -81,6 +165,20 @@ bool dmgl_memory_has_bootloader(const dmgl_memory_t *memory)
     return g_test_bus.memory.has_bootloader;
 }
 
+bool dmgl_memory_fault(const dmgl_memory_t *memory)
+{
+    return g_test_bus.memory.fault;
+}
+
+dmgl_error_e dmgl_memory_fork(dmgl_memory_t *memory, dmgl_memory_t *parent)
+{
+    g_test_bus.memory.memory = memory;
+    g_test_bus.memory.parent = parent;
+    g_test_bus.memory.initialized = true;
+
+    return g_test_bus.memory.status;
+}
+
 dmgl_error_e dmgl_memory_initialize(dmgl_memory_t *memory, const dmgl_t *context)
 {
     g_test_bus.memory.memory = memory;
@@ -90,6 +188,14 @@ dmgl_error_e dmgl_memory_initialize(dmgl_memory_t *memory, const dmgl_t *context
     return g_test_bus.memory.status;
 }
 
+dmgl_error_e dmgl_memory_load(dmgl_memory_t *memory, const uint8_t *data)
+{
+    g_test_bus.memory.memory = memory;
+    g_test_bus.memory.state = data;
+
+    return g_test_bus.memory.status;
+}
+
 uint8_t dmgl_memory_read(const dmgl_memory_t *memory, uint16_t address)
 {
     g_test_bus.memory.memory = memory;
@@ -98,9 +204,32 @@ uint8_t dmgl_memory_read(const dmgl_memory_t *memory, uint16_t address)
     return g_test_bus.memory.value;
 }
 
-void dmgl_memory_reset(dmgl_memory_t *memory)
+dmgl_error_e dmgl_memory_reset(dmgl_memory_t *memory)
 {
     g_test_bus.memory.reset = true;
+
+    for(uint32_t page = 0; page < 256; ++page) {
+        memory->page.read[page] = g_test_bus.memory.mapped ? g_test_bus.memory.page : NULL;
+        memory->page.write[page] = g_test_bus.memory.mapped ? g_test_bus.memory.page : NULL;
+    }
+
+    return g_test_bus.memory.status;
+}
+
+size_t dmgl_memory_save(const dmgl_memory_t *memory, uint8_t *data)
+{
+    g_test_bus.memory.memory = memory;
+    g_test_bus.memory.state = data;
+
+    return g_test_bus.memory.length;
+}
+
+const uint8_t *dmgl_memory_tile(dmgl_memory_t *memory, uint16_t tile)
+{
+    g_test_bus.memory.memory = memory;
+    g_test_bus.memory.address = tile;
+
+    return g_test_bus.memory.page;
 }
 
 const char *dmgl_memory_title(const dmgl_memory_t *memory)
@@ -123,22 +252,29 @@ void dmgl_memory_write(dmgl_memory_t *memory, uint16_t address, uint8_t value)
     g_test_bus.memory.value = value;
 }
 
-dmgl_error_e dmgl_processor_clock(dmgl_processor_t *processor)
+void dmgl_processor_fork(dmgl_processor_t *processor, dmgl_bus_t *bus)
 {
     g_test_bus.processor.processor = processor;
-    g_test_bus.processor.clock = true;
-
-    return g_test_bus.processor.status;
+    g_test_bus.processor.bus = bus;
 }
 
-void dmgl_processor_initialize(dmgl_processor_t *processor, bool has_bootloader, uint8_t checksum)
+void dmgl_processor_initialize(dmgl_processor_t *processor, dmgl_bus_t *bus, bool has_bootloader, uint8_t checksum)
 {
     g_test_bus.processor.processor = processor;
+    g_test_bus.processor.bus = bus;
     g_test_bus.processor.has_bootloader = has_bootloader;
     g_test_bus.processor.checksum = checksum;
     g_test_bus.processor.initialized = true;
 }
 
+size_t dmgl_processor_load(dmgl_processor_t *processor, const uint8_t *data)
+{
+    g_test_bus.processor.processor = processor;
+    g_test_bus.processor.state = data;
+
+    return g_test_bus.processor.length;
+}
+
 uint8_t dmgl_processor_read(const dmgl_processor_t *processor, uint16_t address)
 {
     g_test_bus.processor.processor = processor;
@@ -152,6 +288,24 @@ void dmgl_processor_reset(dmgl_processor_t *processor)
     g_test_bus.processor.reset = true;
 }
 
+dmgl_error_e dmgl_processor_run(dmgl_processor_t *processor, uint64_t limit, uint32_t *cycle)
+{
+    g_test_bus.processor.processor = processor;
+    g_test_bus.processor.clock = true;
+    ++g_test_bus.processor.cycle;
+    *cycle = 4;
+
+    return g_test_bus.processor.status;
+}
+
+size_t dmgl_processor_save(const dmgl_processor_t *processor, uint8_t *data)
+{
+    g_test_bus.processor.processor = processor;
+    g_test_bus.processor.state = data;
+
+    return g_test_bus.processor.length;
+}
+
 void dmgl_processor_uninitialize(dmgl_processor_t *processor)
 {
     g_test_bus.processor.processor = processor;
@@ -165,6 +319,64 @@ void dmgl_processor_write(dmgl_processor_t *processor, uint16_t address, uint8_t
     g_test_bus.processor.value = value;
 }
 
+uint32_t dmgl_video_event(dmgl_video_t *video)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.event = true;
+
+    return g_test_bus.video.delay;
+}
+
+void dmgl_video_initialize(dmgl_video_t *video, dmgl_bus_t *bus, bool has_bootloader)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.bus = bus;
+    g_test_bus.video.has_bootloader = has_bootloader;
+    g_test_bus.video.initialized = true;
+}
+
+size_t dmgl_video_load(dmgl_video_t *video, const uint8_t *data)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.state = data;
+
+    return g_test_bus.video.length;
+}
+
+uint8_t dmgl_video_read(const dmgl_video_t *video, uint16_t address)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.address = address;
+
+    return g_test_bus.video.value;
+}
+
+void dmgl_video_reset(dmgl_video_t *video)
+{
+    g_test_bus.video.reset = true;
+}
+
+size_t dmgl_video_save(const dmgl_video_t *video, uint8_t *data)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.state = data;
+
+    return g_test_bus.video.length;
+}
+
+void dmgl_video_uninitialize(dmgl_video_t *video)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.initialized = false;
+}
+
+void dmgl_video_write(dmgl_video_t *video, uint16_t address, uint8_t value)
+{
+    g_test_bus.video.video = video;
+    g_test_bus.video.address = address;
+    g_test_bus.video.value = value;
+}
+
 /*!
  * @brief Initilalize test context.
  */
@@ -173,47 +385,254 @@ static inline void dmgl_test_initialize(void)
     memset(&g_test_bus, 0, sizeof(g_test_bus));
 }
 
+/*!
+ * @brief Test bus block.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_block(void)
+{
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+    g_test_bus.memory.bank = 2;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+
+        if(DMGL_ASSERT(dmgl_bus_block(bus, address) == ((address < 0x8000) ? ((2 << 16) | address) : UINT32_MAX))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    g_test_bus.memory.has_bootloader = true;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+
+        if(DMGL_ASSERT(dmgl_bus_block(bus, address) == (((address >= 0x0100) && (address < 0x8000)) ? ((2 << 16) | address) : UINT32_MAX))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test bus clock.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
 static dmgl_error_e dmgl_test_bus_clock(void)
 {
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
     dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
     g_test_bus.processor.status = DMGL_FAILURE;
 
-    if(DMGL_ASSERT(dmgl_bus_clock() == DMGL_FAILURE)) {
+    if(DMGL_ASSERT(dmgl_bus_clock(bus) == DMGL_FAILURE)) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
+    dmgl_bus_uninitialize(bus);
     dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
 
-    if(DMGL_ASSERT((dmgl_bus_clock() == DMGL_SUCCESS)
+    if(DMGL_ASSERT((dmgl_bus_clock(bus) == DMGL_SUCCESS)
+            && (g_test_bus.video.video != NULL)
+            && (g_test_bus.video.event == true)
+            && (g_test_bus.processor.cycle == 80 / 4))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT((dmgl_bus_clock(bus) == DMGL_COMPLETE)
             && (g_test_bus.processor.processor != NULL)
-            && (g_test_bus.processor.clock == true))) {
+            && (g_test_bus.processor.clock == true)
+            && (g_test_bus.processor.cycle == (DMGL_BUS_FRAME + 3) / 4))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT((dmgl_bus_clock(bus) == DMGL_COMPLETE)
+            && (g_test_bus.processor.cycle == ((2 * DMGL_BUS_FRAME) + 3) / 4))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
+    g_test_bus.memory.fault = true;
+
+    if(DMGL_ASSERT(dmgl_bus_clock(bus) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus cycle.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_cycle(void)
+{
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
     dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
+    if(DMGL_ASSERT(dmgl_bus_cycle(bus) == 0)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_bus.video.delay = 456;
 
-    for(uint32_t cycle = 0; cycle < (4194304 / 60) - 1; ++cycle) {
+    for(uint32_t frame = 1; frame <= 4; ++frame) {
+        dmgl_error_e status;
 
-        if(DMGL_ASSERT(dmgl_bus_clock() == DMGL_SUCCESS)) {
+        while((status = dmgl_bus_clock(bus)) == DMGL_SUCCESS);
+
+        if(DMGL_ASSERT((status == DMGL_COMPLETE)
+                && (dmgl_bus_cycle(bus) == (g_test_bus.processor.cycle * 4))
+                && (dmgl_bus_cycle(bus) >= (frame * DMGL_BUS_FRAME)))) {
             result = DMGL_FAILURE;
             goto exit;
         }
     }
 
-    if(DMGL_ASSERT(dmgl_bus_clock() == DMGL_COMPLETE)) {
+exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus frame.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_frame(void)
+{
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
+    if(DMGL_ASSERT(dmgl_bus_frame(bus) == &((const dmgl_video_t *)g_test_bus.video.video)->pixel[0][0])) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_fork(void)
+{
+    dmgl_t context = {};
+    const dmgl_memory_t *memory;
+    dmgl_bus_t *bus = NULL, *parent = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT(dmgl_bus_initialize(&parent, &context) == DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    memory = g_test_bus.memory.memory;
+    dmgl_bus_clock(parent);
+    g_test_bus.buffer.status = DMGL_FAILURE;
+    g_test_bus.memory.initialized = false;
+
+    if(DMGL_ASSERT((dmgl_bus_fork(&bus, parent) == DMGL_FAILURE)
+            && (bus == NULL)
+            && (g_test_bus.memory.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_bus.buffer.status = DMGL_SUCCESS;
+    g_test_bus.memory.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_bus_fork(&bus, parent) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_bus_uninitialize(bus);
+    bus = NULL;
+    g_test_bus.memory.status = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((dmgl_bus_fork(&bus, parent) == DMGL_SUCCESS)
+            && (bus != NULL)
+            && (bus != parent)
+            && (g_test_bus.processor.bus == bus)
+            && (g_test_bus.memory.memory != NULL)
+            && (g_test_bus.memory.memory != memory)
+            && (g_test_bus.memory.parent == memory)
+            && (g_test_bus.memory.initialized == true)
+            && (dmgl_bus_cycle(bus) == dmgl_bus_cycle(parent)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
+    dmgl_bus_uninitialize(parent);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus histogram.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_histogram(void)
+{
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
+    if(DMGL_ASSERT((dmgl_bus_histogram(bus) == NULL)
+            && (dmgl_bus_sample(bus, 16) == DMGL_SUCCESS)
+            && (dmgl_bus_histogram(bus) == g_test_bus.histogram.histogram))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
@@ -226,34 +645,53 @@ exit:
 static dmgl_error_e dmgl_test_bus_initialize(void)
 {
     dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
+    dmgl_test_initialize();
+    g_test_bus.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_bus_initialize(&bus, &context) == DMGL_FAILURE)
+            && (bus == NULL)
+            && (g_test_bus.memory.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
     dmgl_test_initialize();
     g_test_bus.memory.status = DMGL_FAILURE;
 
-    if(DMGL_ASSERT(dmgl_bus_initialize(&context) == DMGL_FAILURE)) {
+    if(DMGL_ASSERT(dmgl_bus_initialize(&bus, &context) == DMGL_FAILURE)) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
+    dmgl_bus_uninitialize(bus);
     dmgl_test_initialize();
     g_test_bus.memory.has_bootloader = true;
     g_test_bus.memory.checksum = 0xEF;
     context.bootloader.data = (uint8_t *)1;
 
-    if(DMGL_ASSERT((dmgl_bus_initialize(&context) == DMGL_SUCCESS)
+    if(DMGL_ASSERT((dmgl_bus_initialize(&bus, &context) == DMGL_SUCCESS)
+            && (bus != NULL)
             && (g_test_bus.memory.memory != NULL)
             && (g_test_bus.memory.context == &context)
             && (g_test_bus.memory.initialized == true)
             && (g_test_bus.processor.processor != NULL)
+            && (g_test_bus.processor.bus == bus)
             && (g_test_bus.processor.has_bootloader == g_test_bus.memory.has_bootloader)
             && (g_test_bus.processor.checksum == g_test_bus.memory.checksum)
-            && (g_test_bus.processor.initialized == true))) {
+            && (g_test_bus.processor.initialized == true)
+            && (g_test_bus.video.video != NULL)
+            && (g_test_bus.video.bus == bus)
+            && (g_test_bus.video.has_bootloader == g_test_bus.memory.has_bootloader)
+            && (g_test_bus.video.initialized == true))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
@@ -265,14 +703,19 @@ exit:
  */
 static dmgl_error_e dmgl_test_bus_interrupt(void)
 {
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
     for(dmgl_interrupt_e set = 0; set < DMGL_INTERRUPT_MAX; ++set) {
 
         for(dmgl_interrupt_e get = 0; get < DMGL_INTERRUPT_MAX; ++get) {
             dmgl_test_initialize();
             g_test_bus.processor.value = 1 << get;
-            dmgl_bus_interrupt(set);
+            dmgl_bus_interrupt(bus, set);
 
             if(DMGL_ASSERT((g_test_bus.processor.processor != NULL)
                     && (g_test_bus.processor.address == 0xFF0F)
@@ -284,6 +727,55 @@ static dmgl_error_e dmgl_test_bus_interrupt(void)
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_load(void)
+{
+    dmgl_t context = {};
+    uint8_t data[256] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    dmgl_bus_t *bus = NULL, *other = NULL;
+    size_t header;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+    dmgl_bus_initialize(&other, &context);
+    g_test_bus.memory.length = 3;
+    g_test_bus.processor.length = 5;
+    g_test_bus.video.length = 7;
+    header = dmgl_bus_save(bus, NULL) - 15;
+
+    while(dmgl_bus_clock(bus) != DMGL_COMPLETE);
+
+    dmgl_bus_save(bus, data);
+
+    if(DMGL_ASSERT((dmgl_bus_load(other, data) == DMGL_SUCCESS)
+            && (dmgl_bus_cycle(other) == dmgl_bus_cycle(bus))
+            && (g_test_bus.memory.state == (data + header))
+            && (g_test_bus.processor.state == (data + header + 3))
+            && (g_test_bus.video.state == (data + header + 8)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_bus.memory.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_bus_load(other, data) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_bus_uninitialize(other);
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
@@ -296,60 +788,306 @@ exit:
 static dmgl_error_e dmgl_test_bus_read(void)
 {
     uint8_t data = 0x00;
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
     for(uint32_t address = 0x0000; address <= 0xFFFF; ++address, ++data) {
-        dmgl_test_initialize();
 
-        switch(address) {
-            case 0xFF0F:
-            case 0xFFFF:
-                g_test_bus.processor.value = data;
+        for(int mapped = false; mapped <= true; ++mapped) {
+            dmgl_test_initialize();
+            g_test_bus.memory.mapped = mapped;
+            dmgl_bus_reset(bus);
 
-                if(DMGL_ASSERT((dmgl_bus_read(address) == data)
-                        && (g_test_bus.processor.processor != NULL)
-                        && (g_test_bus.processor.address == address))) {
-                    result = DMGL_FAILURE;
-                    goto exit;
-                }
-                break;
-            default:
-                g_test_bus.memory.value = data;
+            if(mapped) {
+                g_test_bus.memory.page[address & 0xFF] = data;
 
-                if(DMGL_ASSERT((dmgl_bus_read(address) == data)
-                        && (g_test_bus.memory.memory != NULL)
-                        && (g_test_bus.memory.address == address))) {
+                if(DMGL_ASSERT((dmgl_bus_read(bus, address) == data)
+                        && (g_test_bus.memory.memory == NULL)
+                        && (g_test_bus.processor.processor == NULL))) {
                     result = DMGL_FAILURE;
                     goto exit;
                 }
-                break;
+                continue;
+            }
+
+            switch(address) {
+                case 0xFF40 ... 0xFF4B:
+                    g_test_bus.video.value = data;
+
+                    if(DMGL_ASSERT((dmgl_bus_read(bus, address) == data)
+                            && (g_test_bus.video.video != NULL)
+                            && (g_test_bus.video.address == address))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                    break;
+                case 0xFF0F:
+                case 0xFFFF:
+                    g_test_bus.processor.value = data;
+
+                    if(DMGL_ASSERT((dmgl_bus_read(bus, address) == data)
+                            && (g_test_bus.processor.processor != NULL)
+                            && (g_test_bus.processor.address == address))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                    break;
+                default:
+                    g_test_bus.memory.value = data;
+
+                    if(DMGL_ASSERT((dmgl_bus_read(bus, address) == data)
+                            && (g_test_bus.memory.memory != NULL)
+                            && (g_test_bus.memory.address == address))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                    break;
+            }
         }
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
 }
 
 /*!
- * @brief Test bus reset.
+ * @brief Test bus reset, restarting the frame alongside video.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
 static dmgl_error_e dmgl_test_bus_reset(void)
 {
+    uint64_t cycle;
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS, status;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_bus_reset(bus) == DMGL_SUCCESS)
+            && (g_test_bus.memory.reset == true)
+            && (g_test_bus.processor.reset == true)
+            && (g_test_bus.video.reset == true))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test_bus.memory.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_bus_reset(bus) == DMGL_FAILURE)
+            && (g_test_bus.memory.reset == true)
+            && (g_test_bus.processor.reset == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_bus_uninitialize(bus);
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+    g_test_bus.video.delay = 456;
+
+    while(dmgl_bus_cycle(bus) < (100 * 456)) {
+
+        if(DMGL_ASSERT(dmgl_bus_clock(bus) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    cycle = dmgl_bus_cycle(bus);
+    dmgl_bus_reset(bus);
+
+    while((status = dmgl_bus_clock(bus)) == DMGL_SUCCESS);
+
+    if(DMGL_ASSERT((status == DMGL_COMPLETE)
+            && (dmgl_bus_cycle(bus) == (cycle + DMGL_BUS_FRAME)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_save(void)
+{
+    dmgl_t context = {};
+    uint8_t data[256] = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
+    size_t header, length;
 
     dmgl_test_initialize();
-    dmgl_bus_reset();
+    dmgl_bus_initialize(&bus, &context);
+    g_test_bus.memory.length = 3;
+    g_test_bus.processor.length = 5;
+    g_test_bus.video.length = 7;
+    length = dmgl_bus_save(bus, NULL);
+    header = length - 15;
+
+    if(DMGL_ASSERT((header > 0)
+            && (g_test_bus.memory.state == NULL)
+            && (g_test_bus.processor.state == NULL)
+            && (g_test_bus.video.state == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
 
-    if(DMGL_ASSERT((g_test_bus.memory.reset == true)
-            && (g_test_bus.processor.reset == true))) {
+    if(DMGL_ASSERT((dmgl_bus_save(bus, data) == length)
+            && (g_test_bus.memory.state == (data + header))
+            && (g_test_bus.processor.state == (data + header + 3))
+            && (g_test_bus.video.state == (data + header + 8)))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus sample.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_sample(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e status;
+    dmgl_bus_t *bus = NULL, *fork = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+    g_test_bus.histogram.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_bus_sample(bus, 0) == DMGL_FAILURE)
+            && (dmgl_bus_sample(bus, 16) == DMGL_FAILURE)
+            && (g_test_bus.histogram.initialized == false)
+            && (dmgl_bus_histogram(bus) == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_bus.histogram.status = DMGL_SUCCESS;
+    g_test_bus.memory.bank = 2;
+
+    if(DMGL_ASSERT((dmgl_bus_sample(bus, 16) == DMGL_SUCCESS)
+            && (g_test_bus.histogram.initialized == true)
+            && (dmgl_bus_clock(bus) == DMGL_SUCCESS)
+            && (g_test_bus.processor.cycle == 16 / 4)
+            && (g_test_bus.histogram.count == 1)
+            && (g_test_bus.histogram.key == (2 << 16)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    while((status = dmgl_bus_clock(bus)) == DMGL_SUCCESS);
+
+    if(DMGL_ASSERT((status == DMGL_COMPLETE)
+            && (g_test_bus.processor.cycle == DMGL_BUS_FRAME / 4)
+            && (g_test_bus.histogram.count == DMGL_BUS_FRAME / 16))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT((dmgl_bus_fork(&fork, bus) == DMGL_SUCCESS)
+            && (dmgl_bus_histogram(fork) == NULL)
+            && (dmgl_bus_histogram(bus) != NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_bus.histogram.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_bus_clock(bus) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_bus_uninitialize(fork);
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus schedule.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_schedule(void)
+{
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
+    for(uint32_t delay = 4; delay <= 16; delay += 4) {
+        g_test_bus.processor.cycle = 0;
+        dmgl_bus_schedule(bus, DMGL_EVENT_FRAME, delay);
+
+        if(DMGL_ASSERT((dmgl_bus_clock(bus) == DMGL_COMPLETE)
+                && (g_test_bus.processor.cycle == delay / 4))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test bus tile.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_bus_tile(void)
+{
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
+    for(uint16_t tile = 0; tile < 384; ++tile) {
+        g_test_bus.memory.memory = NULL;
+
+        if(DMGL_ASSERT((dmgl_bus_tile(bus, tile) == g_test_bus.memory.page)
+                && (g_test_bus.memory.memory != NULL)
+                && (g_test_bus.memory.address == tile))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
@@ -361,17 +1099,21 @@ exit:
  */
 static dmgl_error_e dmgl_test_bus_title(void)
 {
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
     dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
     g_test_bus.memory.title = "Test";
 
-    if(DMGL_ASSERT(!strcmp(dmgl_bus_title(), "Test"))) {
+    if(DMGL_ASSERT(!strcmp(dmgl_bus_title(bus), "Test"))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
@@ -383,21 +1125,30 @@ exit:
  */
 static dmgl_error_e dmgl_test_bus_uninitialize(void)
 {
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
     dmgl_test_initialize();
     g_test_bus.memory.initialized = true;
     g_test_bus.processor.initialized = true;
-    dmgl_bus_uninitialize();
+    g_test_bus.video.initialized = true;
+    dmgl_bus_uninitialize(bus);
 
     if(DMGL_ASSERT((g_test_bus.memory.memory != NULL)
             && (g_test_bus.memory.initialized == false)
             && (g_test_bus.processor.processor != NULL)
-            && (g_test_bus.processor.initialized == false))) {
+            && (g_test_bus.processor.initialized == false)
+            && (g_test_bus.video.video != NULL)
+            && (g_test_bus.video.initialized == false))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
+    dmgl_bus_uninitialize(NULL);
+
 exit:
     DMGL_TEST_RESULT(result);
 
@@ -411,36 +1162,67 @@ exit:
 static dmgl_error_e dmgl_test_bus_write(void)
 {
     uint8_t data = 0x00;
+    dmgl_t context = {};
+    dmgl_bus_t *bus = NULL;
     dmgl_error_e result = DMGL_SUCCESS;
 
+    dmgl_test_initialize();
+    dmgl_bus_initialize(&bus, &context);
+
     for(uint32_t address = 0x0000; address <= 0xFFFF; ++address, ++data) {
-        dmgl_test_initialize();
-        dmgl_bus_write(address, data);
 
-        switch(address) {
-            case 0xFF0F:
-            case 0xFFFF:
+        for(int mapped = false; mapped <= true; ++mapped) {
+            dmgl_test_initialize();
+            g_test_bus.memory.mapped = mapped;
+            dmgl_bus_reset(bus);
+            dmgl_bus_write(bus, address, data);
 
-                if(DMGL_ASSERT((g_test_bus.processor.processor != NULL)
-                        && (g_test_bus.processor.address == address)
-                        && (g_test_bus.processor.value == data))) {
-                    result = DMGL_FAILURE;
-                    goto exit;
-                }
-                break;
-            default:
+            if(mapped) {
 
-                if(DMGL_ASSERT((g_test_bus.memory.memory != NULL)
-                        && (g_test_bus.memory.address == address)
-                        && (g_test_bus.memory.value == data))) {
+                if(DMGL_ASSERT((g_test_bus.memory.page[address & 0xFF] == data)
+                        && (g_test_bus.memory.memory == NULL)
+                        && (g_test_bus.processor.processor == NULL))) {
                     result = DMGL_FAILURE;
                     goto exit;
                 }
-                break;
+                continue;
+            }
+
+            switch(address) {
+                case 0xFF40 ... 0xFF4B:
+
+                    if(DMGL_ASSERT((g_test_bus.video.video != NULL)
+                            && (g_test_bus.video.address == address)
+                            && (g_test_bus.video.value == data))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                    break;
+                case 0xFF0F:
+                case 0xFFFF:
+
+                    if(DMGL_ASSERT((g_test_bus.processor.processor != NULL)
+                            && (g_test_bus.processor.address == address)
+                            && (g_test_bus.processor.value == data))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                    break;
+                default:
+
+                    if(DMGL_ASSERT((g_test_bus.memory.memory != NULL)
+                            && (g_test_bus.memory.address == address)
+                            && (g_test_bus.memory.value == data))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                    break;
+            }
         }
     }
 
 exit:
+    dmgl_bus_uninitialize(bus);
     DMGL_TEST_RESULT(result);
 
     return result;
@@ -450,8 +1232,11 @@ int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_bus_clock, dmgl_test_bus_initialize, dmgl_test_bus_interrupt, dmgl_test_bus_read,
-        dmgl_test_bus_reset, dmgl_test_bus_title, dmgl_test_bus_uninitialize, dmgl_test_bus_write,
+        dmgl_test_bus_block, dmgl_test_bus_clock, dmgl_test_bus_cycle, dmgl_test_bus_fork,
+        dmgl_test_bus_frame, dmgl_test_bus_histogram, dmgl_test_bus_initialize, dmgl_test_bus_interrupt,
+        dmgl_test_bus_load, dmgl_test_bus_read, dmgl_test_bus_reset, dmgl_test_bus_sample,
+        dmgl_test_bus_save, dmgl_test_bus_schedule, dmgl_test_bus_tile, dmgl_test_bus_title,
+        dmgl_test_bus_uninitialize, dmgl_test_bus_write,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
@@ -43,10 +43,13 @@ typedef struct {
     } checksum;                                     /*!< Cartridge checksum */
 
     struct {
-        uint8_t *bank[2];                           /*!< Cartridge RAM bank */
-        uint8_t data[8 * 1024];                     /*!< Cartridge RAM data */
+        dmgl_page_t *bank[64];                      /*!< Cartridge RAM bank pages */
+        dmgl_page_t data[32];                       /*!< Cartridge RAM data pages */
+        size_t index;                               /*!< Cartridge RAM data page index */
         bool allocate_bank;                         /*!< Cartridge RAM allocate bank flag */
         bool allocate_data;                         /*!< Cartridge RAM allocate data flag */
+        bool shared;                                /*!< Cartridge RAM shared flag */
+        bool copy_failure;                          /*!< Cartridge RAM copy failure flag, set to fail shared page duplication */
     } ram;                                          /*!< Cartridge RAM */
 
     struct {
@@ -54,6 +57,15 @@ typedef struct {
         uint8_t data[16 * 1024];                    /*!< Cartridge ROM data */
         bool allocate_bank;                         /*!< Cartridge ROM allocate bank flag */
     } rom;                                          /*!< Cartridge ROM */
+
+    struct {
+        dmgl_cartridge_t cartridge;                 /*!< Cartridge fork context */
+        dmgl_page_t *page[64];                      /*!< Cartridge fork RAM pages */
+        const uint8_t *bank[2];                     /*!< Cartridge fork ROM bank */
+        size_t share;                               /*!< Cartridge fork RAM page share count */
+        bool allocate_bank;                         /*!< Cartridge fork ROM allocate bank flag */
+        bool allocate_page;                         /*!< Cartridge fork RAM allocate page flag */
+    } fork;                                         /*!< Cartridge fork */
 } dmgl_test_cartridge_t;
 
 static dmgl_test_cartridge_t g_test_cartridge = {}; /*!< Cartridge test context */
@@ -67,14 +79,19 @@ void *dmgl_buffer_allocate(size_t length)
     void *result = NULL;
 
     switch(length) {
-        case 8:
+        case 32 * sizeof(dmgl_page_t *):
             result = g_test_cartridge.ram.allocate_bank ? g_test_cartridge.ram.bank : NULL;
             break;
-        case 8 * 1024:
-            result = g_test_cartridge.ram.allocate_data ? g_test_cartridge.ram.data : NULL;
+        case 64 * sizeof(dmgl_page_t *):
+            result = g_test_cartridge.fork.allocate_page ? g_test_cartridge.fork.page : NULL;
             break;
         case 16:
-            result = g_test_cartridge.rom.allocate_bank ? g_test_cartridge.rom.bank : NULL;
+
+            if(g_test_cartridge.rom.allocate_bank) {
+                result = g_test_cartridge.rom.bank;
+            } else if(g_test_cartridge.fork.allocate_bank) {
+                result = g_test_cartridge.fork.bank;
+            }
             break;
         default:
             break;
@@ -102,6 +119,55 @@ dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line,
     return DMGL_FAILURE;
 }
 
+dmgl_error_e dmgl_page_allocate_arena(dmgl_page_t **page, size_t count, uint8_t value)
+{
+    dmgl_error_e result = DMGL_FAILURE;
+
+    if(g_test_cartridge.ram.allocate_data) {
+
+        for(size_t index = 0; index < count; ++index) {
+            page[index] = &g_test_cartridge.ram.data[g_test_cartridge.ram.index++ % 32];
+            memset(page[index]->data, value, sizeof(page[index]->data));
+        }
+
+        result = DMGL_SUCCESS;
+    }
+
+    return result;
+}
+
+void dmgl_page_free(dmgl_page_t *page)
+{
+    return;
+}
+
+dmgl_page_t *dmgl_page_share(dmgl_page_t *page)
+{
+    ++g_test_cartridge.fork.share;
+
+    return page;
+}
+
+bool dmgl_page_shared(const dmgl_page_t *page)
+{
+    return g_test_cartridge.ram.shared;
+}
+
+uint8_t *dmgl_page_write(dmgl_page_t **page)
+{
+    return g_test_cartridge.ram.copy_failure ? NULL : (*page)->data;
+}
+
+/*!
+ * @brief Query test cartridge RAM data byte.
+ * @param[in] address Byte address
+ * @return Pointer to byte
+ */
+static inline uint8_t *dmgl_test_data(uint16_t address)
+{
+    return &g_test_cartridge.ram.data[address / DMGL_PAGE_LENGTH].data[address % DMGL_PAGE_LENGTH];
+}
+
 /*!
  * @brief Initilalize test context.
  */
@@ -109,12 +175,15 @@ static inline void dmgl_test_initialize(void)
 {
     memset(&g_test_cartridge, 0, sizeof(g_test_cartridge));
 
+    for(size_t index = 0; index < 64; ++index) {
+        g_test_cartridge.ram.bank[index] = &g_test_cartridge.ram.data[index % 32];
+    }
+
     for(size_t index = 0; index < 2; ++index) {
-        g_test_cartridge.ram.bank[index] = g_test_cartridge.ram.data;
         g_test_cartridge.rom.bank[index] = g_test_cartridge.rom.data;
     }
 
-    g_test_cartridge.cartridge.ram.bank = g_test_cartridge.ram.bank;
+    g_test_cartridge.cartridge.ram.page = g_test_cartridge.ram.bank;
     g_test_cartridge.cartridge.ram.count = 2;
     g_test_cartridge.cartridge.rom.bank = g_test_cartridge.rom.bank;
     g_test_cartridge.cartridge.rom.count = 2;
@@ -143,6 +212,65 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test cartridge fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_cartridge_fork(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT(dmgl_cartridge_fork(&g_test_cartridge.fork.cartridge, &g_test_cartridge.cartridge) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test_cartridge.fork.allocate_page = true;
+
+    if(DMGL_ASSERT(dmgl_cartridge_fork(&g_test_cartridge.fork.cartridge, &g_test_cartridge.cartridge) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test_cartridge.fork.allocate_bank = true;
+    g_test_cartridge.fork.allocate_page = true;
+
+    if(DMGL_ASSERT((dmgl_cartridge_fork(&g_test_cartridge.fork.cartridge, &g_test_cartridge.cartridge) == DMGL_SUCCESS)
+            && (g_test_cartridge.fork.share == 64)
+            && (g_test_cartridge.fork.cartridge.ram.page == g_test_cartridge.fork.page)
+            && (g_test_cartridge.fork.cartridge.ram.count == 2)
+            && (g_test_cartridge.fork.cartridge.rom.bank == g_test_cartridge.fork.bank)
+            && (g_test_cartridge.fork.cartridge.rom.count == 2))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < 64; ++index) {
+
+        if(DMGL_ASSERT(g_test_cartridge.fork.page[index] == g_test_cartridge.ram.bank[index])) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    for(size_t index = 0; index < 2; ++index) {
+
+        if(DMGL_ASSERT(g_test_cartridge.fork.bank[index] == g_test_cartridge.rom.bank[index])) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test cartridge initialize.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -264,6 +392,47 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test cartridge load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_cartridge_load(void)
+{
+    uint8_t data[2 * 8 * 1024];
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    for(size_t index = 0; index < sizeof(data); ++index) {
+        data[index] = index / (8 * 1024) + 1;
+    }
+
+    if(DMGL_ASSERT(dmgl_cartridge_load(&g_test_cartridge.cartridge, data) == DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(uint16_t address = 0x0000; address <= 0x1FFF; ++address) {
+
+        if(DMGL_ASSERT(*dmgl_test_data(address) == 2)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    g_test_cartridge.ram.copy_failure = true;
+
+    if(DMGL_ASSERT(dmgl_cartridge_load(&g_test_cartridge.cartridge, data) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test cartridge RAM count.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -285,6 +454,67 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test cartridge RAM map read.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_cartridge_ram_map_read(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_cartridge.ram.shared = true;
+
+    for(size_t index = 0; index < 2; ++index) {
+
+        for(uint16_t address = 0x0000; address <= 0x1FFF; ++address) {
+
+            if(DMGL_ASSERT(dmgl_cartridge_ram_map_read(&g_test_cartridge.cartridge, index, address) == dmgl_test_data(address))) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test cartridge RAM map write.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_cartridge_ram_map_write(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(size_t index = 0; index < 2; ++index) {
+
+        for(uint16_t address = 0x0000; address <= 0x1FFF; ++address) {
+            dmgl_test_initialize();
+
+            if(DMGL_ASSERT(dmgl_cartridge_ram_map_write(&g_test_cartridge.cartridge, index, address) == dmgl_test_data(address))) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+
+            g_test_cartridge.ram.shared = true;
+
+            if(DMGL_ASSERT(dmgl_cartridge_ram_map_write(&g_test_cartridge.cartridge, index, address) == NULL)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test cartridge RAM read.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -298,7 +528,7 @@ static dmgl_error_e dmgl_test_cartridge_ram_read(void)
 
         for(uint16_t address = 0x0000; address <= 0x1FFF; ++address, ++data) {
             dmgl_test_initialize();
-            g_test_cartridge.ram.data[address] = data;
+            *dmgl_test_data(address) = data;
 
             if(DMGL_ASSERT(dmgl_cartridge_ram_read(&g_test_cartridge.cartridge, index, address) == data)) {
                 result = DMGL_FAILURE;
@@ -328,13 +558,24 @@ static dmgl_error_e dmgl_test_cartridge_ram_write(void)
             dmgl_test_initialize();
             dmgl_cartridge_ram_write(&g_test_cartridge.cartridge, index, address, data);
 
-            if(DMGL_ASSERT(g_test_cartridge.ram.data[address] == data)) {
+            if(DMGL_ASSERT((*dmgl_test_data(address) == data)
+                    && (dmgl_cartridge_fault(&g_test_cartridge.cartridge) == false))) {
                 result = DMGL_FAILURE;
                 goto exit;
             }
         }
     }
 
+    dmgl_test_initialize();
+    g_test_cartridge.ram.copy_failure = true;
+    dmgl_cartridge_ram_write(&g_test_cartridge.cartridge, 0, 0x0000, 0x5A);
+
+    if(DMGL_ASSERT((*dmgl_test_data(0x0000) == 0x00)
+            && (dmgl_cartridge_fault(&g_test_cartridge.cartridge) == true))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
 exit:
     DMGL_TEST_RESULT(result);
 
@@ -355,23 +596,33 @@ static dmgl_error_e dmgl_test_cartridge_reset(void)
     for(size_t index = 0; index < 2; ++index) {
 
         for(uint16_t address = 0x0000; address <= 0x1FFF; ++address, ++data) {
-            g_test_cartridge.cartridge.ram.bank[index][address] = data;
+            g_test_cartridge.cartridge.ram.page[(index * 32) + (address / DMGL_PAGE_LENGTH)]->data[address % DMGL_PAGE_LENGTH] = data;
         }
     }
 
-    dmgl_cartridge_reset(&g_test_cartridge.cartridge);
+    if(DMGL_ASSERT(dmgl_cartridge_reset(&g_test_cartridge.cartridge) == DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
 
     for(size_t index = 0; index < 2; ++index) {
 
         for(uint16_t address = 0x0000; address <= 0x1FFF; ++address, ++data) {
 
-            if(DMGL_ASSERT(g_test_cartridge.cartridge.ram.bank[index][address] == 0xFF)) {
+            if(DMGL_ASSERT(g_test_cartridge.cartridge.ram.page[(index * 32) + (address / DMGL_PAGE_LENGTH)]->data[address % DMGL_PAGE_LENGTH] == 0xFF)) {
                 result = DMGL_FAILURE;
                 goto exit;
             }
         }
     }
 
+    g_test_cartridge.ram.copy_failure = true;
+
+    if(DMGL_ASSERT(dmgl_cartridge_reset(&g_test_cartridge.cartridge) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
 exit:
     DMGL_TEST_RESULT(result);
 
@@ -399,6 +650,33 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test cartridge ROM map.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_cartridge_rom_map(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    for(size_t index = 0; index < 2; ++index) {
+
+        for(uint16_t address = 0x0000; address <= 0x3FFF; ++address) {
+
+            if(DMGL_ASSERT(dmgl_cartridge_rom_map(&g_test_cartridge.cartridge, index, address) == &g_test_cartridge.rom.data[address])) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test cartridge ROM read.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -427,6 +705,41 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test cartridge save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_cartridge_save(void)
+{
+    uint8_t data[2 * 8 * 1024] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    for(uint16_t address = 0x0000; address <= 0x1FFF; ++address) {
+        *dmgl_test_data(address) = address;
+    }
+
+    if(DMGL_ASSERT((dmgl_cartridge_save(&g_test_cartridge.cartridge, NULL) == sizeof(data))
+            && (dmgl_cartridge_save(&g_test_cartridge.cartridge, data) == sizeof(data)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < sizeof(data); ++index) {
+
+        if(DMGL_ASSERT(data[index] == (uint8_t)(index % (8 * 1024)))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test cartridge title.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -484,7 +797,7 @@ static dmgl_error_e dmgl_test_cartridge_uninitialize(void)
     dmgl_test_initialize();
     dmgl_cartridge_uninitialize(&g_test_cartridge.cartridge);
 
-    if(DMGL_ASSERT((g_test_cartridge.cartridge.ram.bank == NULL)
+    if(DMGL_ASSERT((g_test_cartridge.cartridge.ram.page == NULL)
             && (g_test_cartridge.cartridge.ram.count == 0)
             && (g_test_cartridge.cartridge.rom.bank == NULL)
             && (g_test_cartridge.cartridge.rom.count == 0))) {
@@ -502,9 +815,11 @@ int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_cartridge_checksum, dmgl_test_cartridge_initialize, dmgl_test_cartridge_ram_count, dmgl_test_cartridge_ram_read,
-        dmgl_test_cartridge_ram_write, dmgl_test_cartridge_reset, dmgl_test_cartridge_rom_count, dmgl_test_cartridge_rom_read,
-        dmgl_test_cartridge_title, dmgl_test_cartridge_type, dmgl_test_cartridge_uninitialize,
+        dmgl_test_cartridge_checksum, dmgl_test_cartridge_fork, dmgl_test_cartridge_initialize, dmgl_test_cartridge_load,
+        dmgl_test_cartridge_ram_count, dmgl_test_cartridge_ram_map_read, dmgl_test_cartridge_ram_map_write, dmgl_test_cartridge_ram_read,
+        dmgl_test_cartridge_ram_write, dmgl_test_cartridge_reset, dmgl_test_cartridge_rom_count, dmgl_test_cartridge_rom_map,
+        dmgl_test_cartridge_rom_read, dmgl_test_cartridge_save, dmgl_test_cartridge_title, dmgl_test_cartridge_type,
+        dmgl_test_cartridge_uninitialize,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
@@ -24,6 +24,8 @@
  * @brief DMGL test application.
  */
 
+#include <bus.h>
+#include <service.h>
 #include <test.h>
 
 /*!
@@ -31,22 +33,50 @@
  * @brief DMGL test context.
  */
 typedef struct {
+    const char *error;                  /*!< DMGL error string */
+
+    struct {
+        dmgl_error_e status;            /*!< DMGL buffer status */
+    } buffer;                           /*!< DMGL buffer */
 
     struct {
         const dmgl_t *context;          /*!< DMGL bus context */
+        const dmgl_bus_t *parent;       /*!< DMGL bus parent context */
         const char *title;              /*!< DMGL bus title string */
         bool initialized;               /*!< DMGL bus intitialized flag */
+        uint64_t cycle;                 /*!< DMGL bus cycle counter */
+        uint8_t pixel[144 * 160];       /*!< DMGL bus pixel buffer */
+        const uint8_t *state;           /*!< DMGL bus state data */
+        size_t length;                  /*!< DMGL bus state length */
+        dmgl_histogram_t histogram;     /*!< DMGL bus sample histogram */
+        uint32_t interval;              /*!< DMGL bus sample interval */
 
         struct {
             dmgl_error_e clock;         /*!< DMGL bus clock status */
+            dmgl_error_e fork;          /*!< DMGL bus fork status */
             dmgl_error_e initialize;    /*!< DMGL bus initialize status */
+            dmgl_error_e load;          /*!< DMGL bus load status */
+            dmgl_error_e sample;        /*!< DMGL bus sample status */
         } status;                       /*!< DMGL bus status */
     } bus;                              /*!< DMGL bus */
 
+    struct {
+        uint64_t value;                 /*!< DMGL hash value */
+    } hash;                             /*!< DMGL hash */
+
     struct {
         const dmgl_t *context;          /*!< DMGL service context */
+        const dmgl_bus_t *bus;          /*!< DMGL service bus context */
         const char *title;              /*!< DMGL service title string */
         bool initialized;               /*!< DMGL service intitialized flag */
+        const uint8_t *color;           /*!< DMGL service frame colors */
+        uint8_t button;                 /*!< DMGL service button mask */
+
+        struct {
+            const void *data;           /*!< DMGL service input data */
+            int length;                 /*!< DMGL service input length */
+            bool uncapped;              /*!< DMGL service uncapped speed flag */
+        } input;                        /*!< DMGL service input */
 
         struct {
             dmgl_error_e initialize;    /*!< DMGL service initialize status */
@@ -54,6 +84,17 @@ typedef struct {
             dmgl_error_e sync;          /*!< DMGL service sync status */
         } status;                       /*!< DMGL service status */
     } service;                          /*!< DMGL service */
+
+    struct {
+        uint32_t count;                 /*!< DMGL rewind entry count */
+        uint32_t pop;                   /*!< DMGL rewind pop counter */
+        uint32_t push;                  /*!< DMGL rewind push counter */
+        bool initialized;               /*!< DMGL rewind initialized flag */
+
+        struct {
+            dmgl_error_e initialize;    /*!< DMGL rewind initialize status */
+        } status;                       /*!< DMGL rewind status */
+    } rewind;                           /*!< DMGL rewind */
 } dmgl_test_t;
 
 static dmgl_test_t g_test = {};         /*!< DMGL test context */
@@ -62,49 +103,199 @@ static dmgl_test_t g_test = {};         /*!< DMGL test context */
 extern "C" {
 #endif /* __cplusplus */
 
-dmgl_error_e dmgl_bus_clock(void)
+void *dmgl_buffer_allocate(size_t length)
+{
+    return (g_test.buffer.status == DMGL_SUCCESS) ? calloc(length, sizeof(uint8_t)) : NULL;
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+}
+
+dmgl_error_e dmgl_bus_clock(dmgl_bus_t *bus)
 {
     return g_test.bus.status.clock;
 }
 
-dmgl_error_e dmgl_bus_initialize(const dmgl_t *context)
+uint64_t dmgl_bus_cycle(const dmgl_bus_t *bus)
 {
+    return g_test.bus.cycle;
+}
+
+const uint8_t *dmgl_bus_frame(const dmgl_bus_t *bus)
+{
+    return g_test.bus.pixel;
+}
+
+dmgl_error_e dmgl_bus_fork(dmgl_bus_t **bus, dmgl_bus_t *parent)
+{
+    *bus = (dmgl_bus_t *)&g_test.bus;
+    g_test.bus.parent = parent;
+    g_test.bus.initialized = true;
+
+    return g_test.bus.status.fork;
+}
+
+const dmgl_histogram_t *dmgl_bus_histogram(const dmgl_bus_t *bus)
+{
+    return g_test.bus.interval ? &g_test.bus.histogram : NULL;
+}
+
+dmgl_error_e dmgl_bus_initialize(dmgl_bus_t **bus, const dmgl_t *context)
+{
+    *bus = (dmgl_bus_t *)&g_test.bus;
     g_test.bus.context = context;
     g_test.bus.initialized = true;
 
     return g_test.bus.status.initialize;
 }
 
-const char *dmgl_bus_title(void)
+dmgl_error_e dmgl_bus_load(dmgl_bus_t *bus, const uint8_t *data)
+{
+    g_test.bus.state = data;
+
+    return g_test.bus.status.load;
+}
+
+dmgl_error_e dmgl_bus_sample(dmgl_bus_t *bus, uint32_t interval)
+{
+
+    if(g_test.bus.status.sample == DMGL_SUCCESS) {
+        g_test.bus.interval = interval;
+    }
+
+    return g_test.bus.status.sample;
+}
+
+size_t dmgl_bus_save(const dmgl_bus_t *bus, uint8_t *data)
+{
+    g_test.bus.state = data;
+
+    return g_test.bus.length;
+}
+
+#if PROFILE
+
+void dmgl_bus_profile(const dmgl_bus_t *bus, dmgl_profile_t *profile)
+{
+    memset(profile, 0, sizeof(*profile));
+    profile->count[0][0x00] = 1;
+    profile->cycle[0][0x00] = 1;
+}
+#endif /* PROFILE */
+
+const char *dmgl_bus_title(const dmgl_bus_t *bus)
 {
     return g_test.bus.title;
 }
 
-void dmgl_bus_uninitialize(void)
+void dmgl_bus_uninitialize(dmgl_bus_t *bus)
 {
     g_test.bus.initialized = false;
 }
 
-dmgl_error_e dmgl_service_initialize(const dmgl_t *context, const char *title)
+const char *dmgl_error(void)
+{
+    return g_test.error;
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+uint64_t dmgl_hash(const void *data, size_t length)
+{
+    return g_test.hash.value;
+}
+
+size_t dmgl_histogram_top(const dmgl_histogram_t *histogram, dmgl_histogram_entry_t *entry, size_t count)
+{
+    size_t result = (histogram->length < count) ? histogram->length : count;
+
+    for(size_t index = 0; index < result; ++index) {
+        entry[index].key = (1 << 16) | (0x4000 + index);
+        entry[index].count = histogram->length - index;
+    }
+
+    return result;
+}
+
+uint32_t dmgl_rewind_count(const dmgl_rewind_t *rewind)
 {
+    return g_test.rewind.count;
+}
+
+dmgl_error_e dmgl_rewind_initialize(dmgl_rewind_t *rewind, size_t length, uint32_t count, uint32_t interval, size_t capacity)
+{
+    g_test.rewind.initialized = (g_test.rewind.status.initialize == DMGL_SUCCESS);
+
+    return g_test.rewind.status.initialize;
+}
+
+dmgl_error_e dmgl_rewind_pop(dmgl_rewind_t *rewind, uint8_t *data)
+{
+    dmgl_error_e result = DMGL_FAILURE;
+
+    if(g_test.rewind.count) {
+        --g_test.rewind.count;
+        ++g_test.rewind.pop;
+        memset(data, 0, 16);
+        memcpy(data, "DMGL\x01\x00\x00\x00", 8);
+        data[8] = 16 + g_test.bus.length;
+        result = DMGL_SUCCESS;
+    }
+
+    return result;
+}
+
+void dmgl_rewind_push(dmgl_rewind_t *rewind, const uint8_t *data)
+{
+    ++g_test.rewind.count;
+    ++g_test.rewind.push;
+}
+
+void dmgl_rewind_uninitialize(dmgl_rewind_t *rewind)
+{
+    g_test.rewind.initialized = false;
+}
+
+bool dmgl_service_button(const dmgl_service_t *service, dmgl_button_e button)
+{
+    return g_test.service.button & (1 << button);
+}
+
+void dmgl_service_frame(dmgl_service_t *service, const uint8_t *color)
+{
+    g_test.service.color = color;
+}
+
+dmgl_error_e dmgl_service_initialize(dmgl_service_t **service, const dmgl_t *context, dmgl_bus_t *bus, const char *title)
+{
+    *service = (dmgl_service_t *)&g_test.service;
     g_test.service.context = context;
+    g_test.service.bus = bus;
     g_test.service.title = title;
+    g_test.service.input.data = context->input.data;
+    g_test.service.input.length = context->input.length;
+    g_test.service.input.uncapped = context->speed.uncapped;
     g_test.service.initialized = true;
 
     return g_test.service.status.initialize;
 }
 
-dmgl_error_e dmgl_service_poll(void)
+dmgl_error_e dmgl_service_poll(dmgl_service_t *service)
 {
     return g_test.service.status.poll;
 }
 
-dmgl_error_e dmgl_service_sync(void)
+dmgl_error_e dmgl_service_sync(dmgl_service_t *service)
 {
     return g_test.service.status.sync;
 }
 
-void dmgl_service_uninitialize(void)
+void dmgl_service_uninitialize(dmgl_service_t *service)
 {
     g_test.service.initialized = false;
 }
@@ -216,11 +407,1008 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test DMGL batch create.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_batch_create(void)
+{
+    dmgl_batch_t *batch = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_batch_create(&batch, 0) == DMGL_FAILURE)
+            && (batch == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_batch_create(&batch, 4) == DMGL_FAILURE)
+            && (batch == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.buffer.status = DMGL_SUCCESS;
+
+    for(unsigned workers = 1; workers <= 16; workers *= 4) {
+
+        if(DMGL_ASSERT((dmgl_batch_create(&batch, workers) == DMGL_SUCCESS)
+                && (batch != NULL))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        dmgl_batch_destroy(batch);
+        batch = NULL;
+    }
+
+exit:
+    dmgl_batch_destroy(batch);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL batch run.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_batch_run(void)
+{
+    dmgl_t context = {};
+    dmgl_batch_t *batch = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+    dmgl_instance_t *instance[8] = {};
+    size_t count = sizeof(instance) / sizeof(*instance);
+
+    dmgl_test_initialize();
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    for(size_t index = 0; index < count; ++index) {
+        context.frame.limit = (index == 5) ? 2 : 0;
+        dmgl_instance_create(&instance[index], &context);
+    }
+
+    if(DMGL_ASSERT((dmgl_batch_create(&batch, 3) == DMGL_SUCCESS)
+            && (dmgl_batch_run(batch, instance, 0, 5) == DMGL_SUCCESS))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(unsigned run = 0; run < 3; ++run) {
+
+        if(DMGL_ASSERT(dmgl_batch_run(batch, instance, count, 5) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    if(DMGL_ASSERT(dmgl_batch_run(batch, instance, 2, 5) == DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < count; ++index) {
+        dmgl_statistics_t statistics = {};
+
+        dmgl_instance_statistics(instance[index], &statistics);
+
+        if(DMGL_ASSERT(statistics.frames == ((index == 5) ? 2 : ((index < 2) ? 20 : 15)))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    g_test.bus.status.clock = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_batch_run(batch, instance, count, 5) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT(dmgl_batch_run(batch, instance, count, 5) == DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_batch_destroy(batch);
+
+    for(size_t index = 0; index < count; ++index) {
+        dmgl_instance_destroy(instance[index]);
+    }
+
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance batch.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_batch(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    dmgl_instance_t *instance[8] = {};
+    size_t count = sizeof(instance) / sizeof(*instance);
+
+    dmgl_test_initialize();
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    for(size_t index = 0; index < count; ++index) {
+        context.frame.limit = (index == 5) ? 2 : 0;
+        dmgl_instance_create(&instance[index], &context);
+    }
+
+    if(DMGL_ASSERT((dmgl_instance_batch(instance, count, 5, 0) == DMGL_FAILURE)
+            && (dmgl_instance_batch(instance, 0, 5, 3) == DMGL_SUCCESS))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(unsigned workers = 1; workers <= 16; workers *= 4) {
+
+        if(DMGL_ASSERT(dmgl_instance_batch(instance, count, 5, workers) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    for(size_t index = 0; index < count; ++index) {
+        dmgl_statistics_t statistics = {};
+
+        dmgl_instance_statistics(instance[index], &statistics);
+
+        if(DMGL_ASSERT(statistics.frames == ((index == 5) ? 2 : 15))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    g_test.bus.status.clock = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_instance_batch(instance, count, 5, 3) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+
+    for(size_t index = 0; index < count; ++index) {
+        dmgl_instance_destroy(instance[index]);
+    }
+
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance create.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_create(void)
+{
+    dmgl_t context = {};
+    uint8_t movie[26] = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.bus.context == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test.bus.status.initialize = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.bus.context == &context)
+            && (g_test.bus.initialized == false)
+            && (g_test.service.context == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test.service.status.initialize = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.bus.initialized == false)
+            && (g_test.service.context == &context)
+            && (g_test.service.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test.bus.title = "Test";
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_SUCCESS)
+            && (instance != NULL)
+            && (g_test.bus.context == &context)
+            && (g_test.bus.initialized == true)
+            && (g_test.service.context == &context)
+            && (g_test.service.bus == (dmgl_bus_t *)&g_test.bus)
+            && (g_test.service.title == g_test.bus.title)
+            && (g_test.service.initialized == true))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(instance);
+    instance = NULL;
+    memcpy(movie, "DMGM\x01\x00\x00\x00\x44\x33\x22\x11\x00\x00\x00\x00\x02\x00\x00\x00\x00\x00\x00\x00\x05\x0A", 26);
+    context.movie.data = movie;
+    context.movie.length = -1;
+    dmgl_test_initialize();
+    g_test.hash.value = 0x11223344;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.service.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    context.movie.length = 25;
+    dmgl_test_initialize();
+    g_test.hash.value = 0x11223344;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.service.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    context.movie.length = 26;
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.service.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test.hash.value = 0x11223344;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_SUCCESS)
+            && (instance != NULL)
+            && (g_test.service.context != &context)
+            && (g_test.service.input.data == &movie[24])
+            && (g_test.service.input.length == 2)
+            && (g_test.service.input.uncapped == true))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT((dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_instance_frame(instance) == DMGL_COMPLETE))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance destroy.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_destroy(void)
+{
+    dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    dmgl_instance_destroy(instance);
+
+    if(DMGL_ASSERT((g_test.bus.initialized == false)
+            && (g_test.service.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(NULL);
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance error.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_error(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    dmgl_instance_t *instance[2] = {};
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance[0], &context);
+    dmgl_instance_create(&instance[1], &context);
+    g_test.error = "Test";
+    g_test.bus.status.clock = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((instance[0] != instance[1])
+            && (dmgl_instance_frame(instance[0]) == DMGL_FAILURE)
+            && !strcmp(dmgl_instance_error(instance[0]), "Test")
+            && !strcmp(dmgl_instance_error(instance[1]), ""))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.error = "Other";
+    g_test.service.status.poll = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_frame(instance[1]) == DMGL_FAILURE)
+            && !strcmp(dmgl_instance_error(instance[0]), "Test")
+            && !strcmp(dmgl_instance_error(instance[1]), "Other"))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance[1]);
+    dmgl_instance_destroy(instance[0]);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_fork(void)
+{
+    dmgl_t context = {}, fork_context = {};
+    dmgl_statistics_t statistics = {};
+    dmgl_instance_t *instance = NULL, *parent = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&parent, &context);
+    g_test.bus.status.clock = DMGL_COMPLETE;
+    dmgl_instance_frame(parent);
+    g_test.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_fork(&instance, parent, &fork_context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.bus.parent == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.buffer.status = DMGL_SUCCESS;
+    g_test.bus.status.fork = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_fork(&instance, parent, &fork_context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.bus.parent == (dmgl_bus_t *)&g_test.bus)
+            && (g_test.bus.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.status.fork = DMGL_SUCCESS;
+    g_test.service.status.initialize = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_fork(&instance, parent, &fork_context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.service.context == &fork_context)
+            && (g_test.service.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.service.status.initialize = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((dmgl_instance_fork(&instance, parent, &fork_context) == DMGL_SUCCESS)
+            && (instance != NULL)
+            && (instance != parent)
+            && (g_test.bus.parent == (dmgl_bus_t *)&g_test.bus)
+            && (g_test.bus.initialized == true)
+            && (g_test.service.context == &fork_context)
+            && (g_test.service.bus == (dmgl_bus_t *)&g_test.bus)
+            && (g_test.service.initialized == true))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_statistics(instance, &statistics);
+
+    if(DMGL_ASSERT(statistics.frames == 1)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    dmgl_instance_destroy(parent);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance frame.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_frame(void)
+{
+    dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    g_test.service.status.poll = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT(dmgl_instance_frame(instance) == DMGL_COMPLETE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.service.status.poll = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_instance_frame(instance) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.service.status.poll = DMGL_SUCCESS;
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT((dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (g_test.service.color == g_test.bus.pixel))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.service.status.sync = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_instance_frame(instance) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance hotspot.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_hotspot(void)
+{
+    dmgl_t context = {};
+    size_t count = 4;
+    dmgl_hotspot_t hotspot[4] = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+
+    if(DMGL_ASSERT((dmgl_instance_hotspot(instance, hotspot, &count) == DMGL_FAILURE)
+            && (count == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(instance);
+    instance = NULL;
+    dmgl_test_initialize();
+    g_test.bus.status.sample = DMGL_FAILURE;
+    context.sample.interval = 64;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.histogram.length = 3;
+    g_test.bus.histogram.total = 6;
+    count = 4;
+
+    if(DMGL_ASSERT((g_test.bus.interval == 64)
+            && (dmgl_instance_hotspot(instance, hotspot, &count) == DMGL_SUCCESS)
+            && (count == 3)
+            && (hotspot[0].bank == 1)
+            && (hotspot[0].address == 0x4000)
+            && (hotspot[0].count == 3)
+            && (hotspot[0].ratio == 0.5)
+            && (hotspot[2].address == 0x4002)
+            && (hotspot[2].count == 1))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.buffer.status = DMGL_FAILURE;
+    count = 4;
+
+    if(DMGL_ASSERT((dmgl_instance_hotspot(instance, hotspot, &count) == DMGL_FAILURE)
+            && (count == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance profile.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_profile(void)
+{
+    dmgl_t context = {};
+    dmgl_profile_t profile = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    profile.count[1][0xFF] = 1;
+
+#if PROFILE
+
+    if(DMGL_ASSERT((dmgl_instance_profile(instance, &profile) == DMGL_SUCCESS)
+            && (profile.count[0][0x00] == 1)
+            && (profile.cycle[0][0x00] == 1)
+            && (profile.count[1][0xFF] == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+#else
+
+    if(DMGL_ASSERT((dmgl_instance_profile(instance, &profile) == DMGL_FAILURE)
+            && (profile.count[1][0xFF] == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+#endif /* PROFILE */
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance statistics.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_statistics(void)
+{
+    dmgl_t context = {};
+    dmgl_statistics_t statistics = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    dmgl_instance_statistics(instance, &statistics);
+
+    if(DMGL_ASSERT((statistics.frames == 0)
+            && (statistics.elapsed >= 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.status.clock = DMGL_COMPLETE;
+    g_test.bus.cycle = 70224 * 2;
+
+    if(DMGL_ASSERT((dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_instance_frame(instance) == DMGL_SUCCESS))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_statistics(instance, &statistics);
+
+    if(DMGL_ASSERT((statistics.frames == 2)
+            && (statistics.elapsed >= 0)
+            && ((statistics.elapsed == 0) || ((statistics.rate > 0) && (statistics.frequency > 0))))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL instance run.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_instance_run(void)
+{
+    dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    g_test.service.status.poll = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT(dmgl_instance_run(instance) == DMGL_SUCCESS)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.service.status.poll = DMGL_SUCCESS;
+    g_test.bus.status.clock = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_instance_run(instance) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(instance);
+    dmgl_test_initialize();
+    context.frame.limit = 2;
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT((dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_instance_frame(instance) == DMGL_COMPLETE)
+            && (dmgl_instance_run(instance) == DMGL_SUCCESS))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL movie length.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_movie_length(void)
+{
+    dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+
+    if(DMGL_ASSERT(dmgl_movie_length(instance) == 0)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(instance);
+    dmgl_test_initialize();
+    context.movie.record = true;
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    if(DMGL_ASSERT((dmgl_movie_length(instance) == 24)
+            && (dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_instance_frame(instance) == DMGL_SUCCESS)
+            && (dmgl_movie_length(instance) == (24 + 2)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL movie save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_movie_save(void)
+{
+    dmgl_t context = {};
+    uint8_t movie[26] = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+
+    if(DMGL_ASSERT(dmgl_movie_save(instance, movie, sizeof(movie)) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(instance);
+    dmgl_test_initialize();
+    g_test.hash.value = 0x11223344;
+    context.movie.record = true;
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.status.clock = DMGL_COMPLETE;
+    g_test.service.button = 0x05;
+    dmgl_instance_frame(instance);
+    g_test.service.button = 0x0A;
+    dmgl_instance_frame(instance);
+
+    if(DMGL_ASSERT((dmgl_movie_save(instance, movie, sizeof(movie) - 1) == DMGL_FAILURE)
+            && (dmgl_movie_save(instance, movie, sizeof(movie)) == DMGL_SUCCESS)
+            && !memcmp(movie, "DMGM\x01\x00\x00\x00\x44\x33\x22\x11\x00\x00\x00\x00\x02\x00\x00\x00\x00\x00\x00\x00\x05\x0A", 26))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL state length.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_state_length(void)
+{
+    dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.length = 32;
+
+    if(DMGL_ASSERT((dmgl_state_length(instance) == (16 + 32))
+            && (g_test.bus.state == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL state load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_state_load(void)
+{
+    dmgl_t context = {};
+    uint8_t data[64] = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.length = 32;
+    dmgl_state_save(instance, data, sizeof(data));
+    g_test.bus.state = NULL;
+
+    if(DMGL_ASSERT((dmgl_state_load(instance, data, 16 + 32) == DMGL_SUCCESS)
+            && (g_test.bus.state == (data + 16)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.state = NULL;
+
+    if(DMGL_ASSERT((dmgl_state_load(instance, data, 8) == DMGL_FAILURE)
+            && (dmgl_state_load(instance, data, 16 + 31) == DMGL_FAILURE)
+            && (g_test.bus.state == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.length = 31;
+
+    if(DMGL_ASSERT(dmgl_state_load(instance, data, sizeof(data)) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.length = 32;
+    ++data[4];
+
+    if(DMGL_ASSERT(dmgl_state_load(instance, data, sizeof(data)) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    --data[4];
+    ++data[0];
+
+    if(DMGL_ASSERT((dmgl_state_load(instance, data, sizeof(data)) == DMGL_FAILURE)
+            && (g_test.bus.state == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    --data[0];
+    g_test.bus.status.load = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_state_load(instance, data, sizeof(data)) == DMGL_FAILURE)
+            && (g_test.bus.state == (data + 16)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL state rewind.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_state_rewind(void)
+{
+    dmgl_t context = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+
+    if(DMGL_ASSERT((dmgl_state_rewind(instance, 1) == DMGL_FAILURE)
+            && (g_test.rewind.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_instance_destroy(instance);
+    dmgl_test_initialize();
+    context.rewind.length = 1;
+    g_test.rewind.status.initialize = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_instance_create(&instance, &context) == DMGL_FAILURE)
+            && (instance == NULL)
+            && (g_test.rewind.initialized == false))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.rewind.status.initialize = DMGL_SUCCESS;
+    g_test.bus.length = 32;
+    dmgl_instance_create(&instance, &context);
+
+    if(DMGL_ASSERT((g_test.rewind.initialized == true)
+            && (dmgl_state_rewind(instance, 1) == DMGL_FAILURE))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test.bus.status.clock = DMGL_COMPLETE;
+
+    for(uint32_t frame = 0; frame < 4; ++frame) {
+
+        if(DMGL_ASSERT(dmgl_instance_frame(instance) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    if(DMGL_ASSERT((g_test.rewind.push == 4)
+            && (dmgl_state_rewind(instance, 2) == DMGL_SUCCESS)
+            && (g_test.rewind.pop == 3)
+            && (g_test.rewind.count == 2)
+            && (dmgl_state_rewind(instance, 8) == DMGL_SUCCESS)
+            && (g_test.rewind.pop == 5)
+            && (g_test.rewind.count == 1))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test DMGL state save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_state_save(void)
+{
+    dmgl_t context = {};
+    uint8_t data[64] = {};
+    dmgl_instance_t *instance = NULL;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_instance_create(&instance, &context);
+    g_test.bus.length = 32;
+
+    if(DMGL_ASSERT((dmgl_state_save(instance, data, 16 + 31) == DMGL_FAILURE)
+            && (g_test.bus.state == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT((dmgl_state_save(instance, data, sizeof(data)) == DMGL_SUCCESS)
+            && (g_test.bus.state == (data + 16))
+            && !memcmp(data, "DMGL", 4)
+            && (data[4] == 1)
+            && (data[8] == (16 + 32)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_instance_destroy(instance);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test,
+        dmgl_test, dmgl_test_batch_create, dmgl_test_batch_run, dmgl_test_instance_batch, dmgl_test_instance_create,
+        dmgl_test_instance_destroy, dmgl_test_instance_error, dmgl_test_instance_fork, dmgl_test_instance_frame,
+        dmgl_test_instance_hotspot, dmgl_test_instance_profile, dmgl_test_instance_run, dmgl_test_instance_statistics,
+        dmgl_test_movie_length, dmgl_test_movie_save, dmgl_test_state_length, dmgl_test_state_load, dmgl_test_state_rewind,
+        dmgl_test_state_save,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
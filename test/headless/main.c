@@ -0,0 +1,243 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Headless service test application.
+ */
+
+#include <time.h>
+#include <service.h>
+#include <test.h>
+
+/*!
+ * @struct dmgl_test_headless_t
+ * @brief Headless service test context.
+ */
+typedef struct {
+    dmgl_service_t *service;                      /*!< Headless service context */
+
+    struct {
+        dmgl_error_e status;                      /*!< Headless buffer status */
+    } buffer;                                     /*!< Headless buffer */
+} dmgl_test_headless_t;
+
+static dmgl_test_headless_t g_test_headless = {}; /*!< Headless service test context */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void *dmgl_buffer_allocate(size_t length)
+{
+    return (g_test_headless.buffer.status == DMGL_SUCCESS) ? calloc(length, sizeof(uint8_t)) : NULL;
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+/*!
+ * @brief Initilalize test context.
+ */
+static inline void dmgl_test_initialize(void)
+{
+    dmgl_service_uninitialize(g_test_headless.service);
+    memset(&g_test_headless, 0, sizeof(g_test_headless));
+}
+
+/*!
+ * @brief Test headless service button.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_service_button(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    uint8_t input[] = { 0x00, 0x01, 0x82, 0xFF, };
+
+    dmgl_test_initialize();
+    context.input.data = input;
+    context.input.length = sizeof(input);
+    dmgl_service_initialize(&g_test_headless.service, &context, NULL, "Test");
+
+    for(size_t frame = 0; frame <= sizeof(input); ++frame) {
+
+        for(dmgl_button_e button = 0; button < DMGL_BUTTON_MAX; ++button) {
+            bool expected = (frame < sizeof(input)) ? ((input[frame] & (1 << button)) ? true : false) : false;
+
+            if(DMGL_ASSERT(dmgl_service_button(g_test_headless.service, button) == expected)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+
+        dmgl_service_poll(g_test_headless.service);
+        dmgl_service_sync(g_test_headless.service);
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test headless service initialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_service_initialize(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_headless.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_service_initialize(&g_test_headless.service, &context, NULL, "Test") == DMGL_FAILURE)
+            && (g_test_headless.service == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_service_initialize(&g_test_headless.service, &context, NULL, "Test") == DMGL_SUCCESS)
+            && (g_test_headless.service != NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test headless service poll.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_service_poll(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_service_initialize(&g_test_headless.service, &context, NULL, "Test");
+
+    for(uint32_t frame = 0; frame < 60; ++frame) {
+
+        if(DMGL_ASSERT(dmgl_service_poll(g_test_headless.service) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test headless service sync.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_service_sync(void)
+{
+    dmgl_t context = {};
+    struct timespec begin, end;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_service_initialize(&g_test_headless.service, &context, NULL, "Test");
+    timespec_get(&begin, TIME_UTC);
+
+    for(uint32_t frame = 0; frame < 600; ++frame) {
+
+        if(DMGL_ASSERT(dmgl_service_sync(g_test_headless.service) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    timespec_get(&end, TIME_UTC);
+
+    if(DMGL_ASSERT((end.tv_sec - begin.tv_sec) < 1)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test headless service uninitialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_service_uninitialize(void)
+{
+    dmgl_t context = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_service_initialize(&g_test_headless.service, &context, NULL, "Test");
+    dmgl_service_uninitialize(g_test_headless.service);
+    g_test_headless.service = NULL;
+    dmgl_service_uninitialize(NULL);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_service_button, dmgl_test_service_initialize, dmgl_test_service_poll, dmgl_test_service_sync,
+        dmgl_test_service_uninitialize,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    dmgl_test_initialize();
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,263 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Common histogram test application.
+ */
+
+#include <histogram.h>
+#include <test.h>
+
+/*!
+ * @struct dmgl_test_histogram_t
+ * @brief Histogram test context.
+ */
+typedef struct {
+    dmgl_histogram_t histogram;                 /*!< Histogram context */
+
+    struct {
+        dmgl_error_e status;                    /*!< Histogram buffer status */
+    } buffer;                                   /*!< Histogram buffer */
+} dmgl_test_histogram_t;
+
+static dmgl_test_histogram_t g_test_histogram = {}; /*!< Histogram test context */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void *dmgl_buffer_allocate(size_t length)
+{
+    return (g_test_histogram.buffer.status == DMGL_SUCCESS) ? calloc(length, sizeof(uint8_t)) : NULL;
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+/*!
+ * @brief Initilalize test context.
+ */
+static inline void dmgl_test_initialize(void)
+{
+    dmgl_histogram_uninitialize(&g_test_histogram.histogram);
+    memset(&g_test_histogram, 0, sizeof(g_test_histogram));
+}
+
+/*!
+ * @brief Test common histogram increment.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_histogram_increment(void)
+{
+    dmgl_histogram_entry_t entry[1] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_histogram_initialize(&g_test_histogram.histogram, 4);
+
+    for(uint32_t key = 0; key < 64; ++key) {
+
+        for(uint32_t count = 0; count <= key; ++count) {
+
+            if(DMGL_ASSERT(dmgl_histogram_increment(&g_test_histogram.histogram, key << 16) == DMGL_SUCCESS)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+    if(DMGL_ASSERT((g_test_histogram.histogram.length == 64)
+            && (g_test_histogram.histogram.capacity == 128)
+            && (g_test_histogram.histogram.total == ((64 * 65) / 2))
+            && (dmgl_histogram_top(&g_test_histogram.histogram, entry, 1) == 1)
+            && (entry[0].key == (63 << 16))
+            && (entry[0].count == 64))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_histogram.buffer.status = DMGL_FAILURE;
+
+    for(uint32_t key = 64; key < 128; ++key) {
+
+        if(dmgl_histogram_increment(&g_test_histogram.histogram, key) == DMGL_FAILURE) {
+            break;
+        }
+    }
+
+    if(DMGL_ASSERT((g_test_histogram.histogram.length == 64)
+            && (g_test_histogram.histogram.capacity == 128))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common histogram initialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_histogram_initialize(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_histogram_initialize(&g_test_histogram.histogram, 0) == DMGL_FAILURE)
+            && (dmgl_histogram_initialize(&g_test_histogram.histogram, 3) == DMGL_FAILURE))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_histogram.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_histogram_initialize(&g_test_histogram.histogram, 4) == DMGL_FAILURE)
+            && (g_test_histogram.histogram.entry == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_histogram.buffer.status = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((dmgl_histogram_initialize(&g_test_histogram.histogram, 4) == DMGL_SUCCESS)
+            && (g_test_histogram.histogram.entry != NULL)
+            && (g_test_histogram.histogram.capacity == 4)
+            && (g_test_histogram.histogram.length == 0)
+            && (g_test_histogram.histogram.total == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common histogram top.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_histogram_top(void)
+{
+    dmgl_histogram_entry_t entry[4] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    const uint32_t key[] = { 0x0150, 0x4000, 0x14000, 0xC000, 0x0100, 0x0150, 0x4000, 0x0150, };
+
+    dmgl_test_initialize();
+    dmgl_histogram_initialize(&g_test_histogram.histogram, 16);
+
+    if(DMGL_ASSERT(dmgl_histogram_top(&g_test_histogram.histogram, entry, 4) == 0)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(uint32_t index = 0; index < (sizeof(key) / sizeof(*key)); ++index) {
+        dmgl_histogram_increment(&g_test_histogram.histogram, key[index]);
+    }
+
+    if(DMGL_ASSERT((dmgl_histogram_top(&g_test_histogram.histogram, entry, 2) == 2)
+            && (entry[0].key == 0x0150)
+            && (entry[0].count == 3)
+            && (entry[1].key == 0x4000)
+            && (entry[1].count == 2))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT((dmgl_histogram_top(&g_test_histogram.histogram, entry, 4) == 4)
+            && (entry[0].count == 3)
+            && (entry[1].count == 2)
+            && (entry[2].count == 1)
+            && (entry[3].count == 1)
+            && (entry[2].key != 0x4000)
+            && (entry[3].key != 0x0150))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common histogram uninitialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_histogram_uninitialize(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_histogram_initialize(&g_test_histogram.histogram, 4);
+    dmgl_histogram_increment(&g_test_histogram.histogram, 0x0100);
+    dmgl_histogram_uninitialize(&g_test_histogram.histogram);
+
+    if(DMGL_ASSERT((g_test_histogram.histogram.entry == NULL)
+            && (g_test_histogram.histogram.capacity == 0)
+            && (g_test_histogram.histogram.length == 0)
+            && (g_test_histogram.histogram.total == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_histogram_increment, dmgl_test_histogram_initialize, dmgl_test_histogram_top, dmgl_test_histogram_uninitialize,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    dmgl_histogram_uninitialize(&g_test_histogram.histogram);
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -34,7 +34,7 @@ build: $(BINARY_FILE)
 clean:
 	@rm -f $(BINARY_FILE)
 	@rm -f $(OBJECT_FILES)
-	@rm -f $(FILE).c.gcov
+	@rm -f *.gcov
 	@rm -f $(SOURCE_DIRECTORY)$(FILE).gcda
 	@rm -f $(SOURCE_DIRECTORY)$(FILE).gcno
 	@rm -f $(SOURCE_DIRECTORY)$(FILE).o
@@ -53,7 +53,7 @@ $(SOURCE_DIRECTORY)$(FILE).o: $(SOURCE_DIRECTORY)$(FILE).c
 	$(CC) $(FLAGS) $(COVERAGE_FLAGS) $(INCLUDE_FLAGS) -c -o $@ $<
 
 $(BINARY_FILE): $(SOURCE_DIRECTORY)$(FILE).o $(OBJECT_FILES)
-	$(CC) $(FLAGS) $(COVERAGE_FLAGS) $(SOURCE_DIRECTORY)$(FILE).o $(OBJECT_FILES) -o $@
+	$(CC) $(FLAGS) $(COVERAGE_FLAGS) $(SOURCE_DIRECTORY)$(FILE).o $(OBJECT_FILES) -pthread -o $@
 
 %.o: %.c
 	$(CC) $(FLAGS) $(INCLUDE_FLAGS) $(TEST_INCLUDE_FLAGS) -c -o $@ $<
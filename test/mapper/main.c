@@ -39,19 +39,24 @@ typedef struct {
         const uint8_t *data;                    /*!< Mapper cartridge data */
         size_t length;                          /*!< Mapper cartridge length */
         dmgl_error_e status;                    /*!< Mapper cartridge status */
+        const dmgl_cartridge_t *parent;         /*!< Mapper cartridge parent context */
         const char *title;                      /*!< Mapper cartridge title string */
         dmgl_cartridge_e type;                  /*!< Mapper cartridge type */
         uint8_t checksum;                       /*!< Mapper cartridge checksum */
         bool initialized;                       /*!< Mapper cartridge initialized flag */
         bool reset;                             /*!< Mapper cartridge reset flag */
+        bool fault;                             /*!< Mapper cartridge fault flag */
     } cartridge;                                /*!< Mapper cartridge */
 
     struct {
         const dmgl_cartridge_t *cartridge;      /*!< Mapper MBC cartridge context */
         void *context;                          /*!< Mapper MBC context */
+        const void *parent;                     /*!< Mapper MBC parent context */
         dmgl_error_e status;                    /*!< Mapper MBC status */
         uint16_t address;                       /*!< Mapper MBC address */
+        uint16_t bank;                          /*!< Mapper MBC ROM bank */
         uint8_t value;                          /*!< Mapper MBC value */
+        uint8_t page[256];                      /*!< Mapper MBC page */
         bool initialized;                       /*!< Mapper MBC initialized flag */
         bool reset;                             /*!< Mapper MBC reset flag */
     } mbc;                                      /*!< Mapper MBC */
@@ -70,6 +75,22 @@ uint8_t dmgl_cartridge_checksum(const dmgl_cartridge_t *cartridge)
     return g_test_mapper.cartridge.checksum;
 }
 
+bool dmgl_cartridge_fault(const dmgl_cartridge_t *cartridge)
+{
+    g_test_mapper.cartridge.cartridge = cartridge;
+
+    return g_test_mapper.cartridge.fault;
+}
+
+dmgl_error_e dmgl_cartridge_fork(dmgl_cartridge_t *cartridge, const dmgl_cartridge_t *parent)
+{
+    g_test_mapper.cartridge.cartridge = cartridge;
+    g_test_mapper.cartridge.parent = parent;
+    g_test_mapper.cartridge.initialized = true;
+
+    return g_test_mapper.cartridge.status;
+}
+
 dmgl_error_e dmgl_cartridge_initialize(dmgl_cartridge_t *cartridge, const uint8_t *data, size_t length)
 {
     g_test_mapper.cartridge.cartridge = cartridge;
@@ -80,9 +101,27 @@ dmgl_error_e dmgl_cartridge_initialize(dmgl_cartridge_t *cartridge, const uint8_
     return g_test_mapper.cartridge.status;
 }
 
-void dmgl_cartridge_reset(dmgl_cartridge_t *cartridge)
+dmgl_error_e dmgl_cartridge_load(dmgl_cartridge_t *cartridge, const uint8_t *data)
+{
+    g_test_mapper.cartridge.cartridge = cartridge;
+    g_test_mapper.cartridge.data = data;
+
+    return g_test_mapper.cartridge.status;
+}
+
+dmgl_error_e dmgl_cartridge_reset(dmgl_cartridge_t *cartridge)
 {
     g_test_mapper.cartridge.reset = true;
+
+    return g_test_mapper.cartridge.status;
+}
+
+size_t dmgl_cartridge_save(const dmgl_cartridge_t *cartridge, uint8_t *data)
+{
+    g_test_mapper.cartridge.cartridge = cartridge;
+    g_test_mapper.cartridge.data = data;
+
+    return g_test_mapper.cartridge.length;
 }
 
 const char *dmgl_cartridge_title(const dmgl_cartridge_t *cartridge)
@@ -105,6 +144,23 @@ void dmgl_cartridge_uninitialize(dmgl_cartridge_t *cartridge)
     g_test_mapper.cartridge.initialized = false;
 }
 
+uint16_t dmgl_mbc_bank(const void *context, uint16_t address)
+{
+    g_test_mapper.mbc.context = (void *)context;
+    g_test_mapper.mbc.address = address;
+
+    return g_test_mapper.mbc.bank;
+}
+
+dmgl_error_e dmgl_mbc_fork(const void *context, void **fork)
+{
+    g_test_mapper.mbc.parent = context;
+    *fork = g_test_mapper.mbc.context;
+    g_test_mapper.mbc.initialized = true;
+
+    return g_test_mapper.mbc.status;
+}
+
 dmgl_error_e dmgl_mbc_initialize(const dmgl_cartridge_t *cartridge, void **context)
 {
     g_test_mapper.mbc.cartridge = cartridge;
@@ -114,6 +170,24 @@ dmgl_error_e dmgl_mbc_initialize(const dmgl_cartridge_t *cartridge, void **conte
     return g_test_mapper.mbc.status;
 }
 
+const uint8_t *dmgl_mbc_map_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address)
+{
+    g_test_mapper.cartridge.cartridge = cartridge;
+    g_test_mapper.mbc.context = context;
+    g_test_mapper.mbc.address = address;
+
+    return g_test_mapper.mbc.page;
+}
+
+uint8_t *dmgl_mbc_map_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address)
+{
+    g_test_mapper.cartridge.cartridge = cartridge;
+    g_test_mapper.mbc.context = context;
+    g_test_mapper.mbc.address = address;
+
+    return g_test_mapper.mbc.page;
+}
+
 uint8_t dmgl_mbc_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address)
 {
     g_test_mapper.cartridge.cartridge = cartridge;
@@ -134,12 +208,24 @@ void dmgl_mbc_uninitialize(void *context)
     g_test_mapper.mbc.initialized = false;
 }
 
-void dmgl_mbc_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value)
+bool dmgl_mbc_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value)
 {
     g_test_mapper.cartridge.cartridge = cartridge;
     g_test_mapper.mbc.context = context;
     g_test_mapper.mbc.address = address;
     g_test_mapper.mbc.value = value;
+
+    return address & 1;
+}
+
+uint16_t dmgl_mbc0_bank(const void *context, uint16_t address)
+{
+    return dmgl_mbc_bank(context, address);
+}
+
+dmgl_error_e dmgl_mbc0_fork(const void *context, void **fork)
+{
+    return dmgl_mbc_fork(context, fork);
 }
 
 dmgl_error_e dmgl_mbc0_initialize(const dmgl_cartridge_t *cartridge, void **context)
@@ -147,6 +233,16 @@ dmgl_error_e dmgl_mbc0_initialize(const dmgl_cartridge_t *cartridge, void **cont
     return dmgl_mbc_initialize(cartridge, context);
 }
 
+const uint8_t *dmgl_mbc0_map_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address)
+{
+    return dmgl_mbc_map_read(cartridge, context, address);
+}
+
+uint8_t *dmgl_mbc0_map_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address)
+{
+    return dmgl_mbc_map_write(cartridge, context, address);
+}
+
 uint8_t dmgl_mbc0_read(const dmgl_cartridge_t *cartridge, void *context, uint16_t address)
 {
     return dmgl_mbc_read(cartridge, context, address);
@@ -162,9 +258,9 @@ void dmgl_mbc0_uninitialize(void *context)
     dmgl_mbc_uninitialize(context);
 }
 
-void dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value)
+bool dmgl_mbc0_write(dmgl_cartridge_t *cartridge, void *context, uint16_t address, uint8_t value)
 {
-    dmgl_mbc_write(cartridge, context, address, value);
+    return dmgl_mbc_write(cartridge, context, address, value);
 }
 
 /*!
@@ -175,6 +271,35 @@ static inline void dmgl_test_initialize(void)
     memset(&g_test_mapper, 0, sizeof(g_test_mapper));
 }
 
+/*!
+ * @brief Test mapper bank.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_bank(void)
+{
+    uint16_t bank = 0;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; address += 0x100, ++bank) {
+        dmgl_test_initialize();
+        g_test_mapper.mapper.context = (void *)1;
+        g_test_mapper.mapper.handler.bank = dmgl_mbc_bank;
+        g_test_mapper.mbc.bank = bank;
+
+        if(DMGL_ASSERT((dmgl_mapper_bank(&g_test_mapper.mapper, address) == bank)
+                && (g_test_mapper.mbc.context == g_test_mapper.mapper.context)
+                && (g_test_mapper.mbc.address == address))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test mapper checksum.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -198,6 +323,81 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test mapper fault.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_fault(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_mapper.cartridge.fault = true;
+
+    if(DMGL_ASSERT((dmgl_mapper_fault(&g_test_mapper.mapper) == true)
+            && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test mapper fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_fork(void)
+{
+    dmgl_mapper_t parent = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_mapper.cartridge.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_mapper_fork(&g_test_mapper.mapper, &parent) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    parent.handler.fork = dmgl_mbc_fork;
+    g_test_mapper.mbc.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_mapper_fork(&g_test_mapper.mapper, &parent) == DMGL_FAILURE)
+            && (g_test_mapper.mapper.handler.fork == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    parent.context = (void *)1;
+    parent.handler.fork = dmgl_mbc_fork;
+    parent.handler.read = dmgl_mbc_read;
+    g_test_mapper.mbc.context = (void *)2;
+
+    if(DMGL_ASSERT((dmgl_mapper_fork(&g_test_mapper.mapper, &parent) == DMGL_SUCCESS)
+            && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
+            && (g_test_mapper.cartridge.parent == &parent.cartridge)
+            && (g_test_mapper.cartridge.initialized == true)
+            && (g_test_mapper.mbc.parent == (void *)1)
+            && (g_test_mapper.mbc.initialized == true)
+            && (g_test_mapper.mapper.context == (void *)2)
+            && (g_test_mapper.mapper.handler.fork == dmgl_mbc_fork)
+            && (g_test_mapper.mapper.handler.read == dmgl_mbc_read))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test mapper initialize.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -216,7 +416,7 @@ static dmgl_error_e dmgl_test_mapper_initialize(void)
 
     for(dmgl_cartridge_e type = 0; type < DMGL_CARTRIDGE_MAX; ++type) {
         const dmgl_mapper_handler_t handler[] = {
-            { dmgl_mbc0_initialize, dmgl_mbc0_read, dmgl_mbc0_reset, dmgl_mbc0_uninitialize, dmgl_mbc0_write, },
+            { dmgl_mbc0_bank, dmgl_mbc0_fork, dmgl_mbc0_initialize, dmgl_mbc0_map_read, dmgl_mbc0_map_write, dmgl_mbc0_read, dmgl_mbc0_reset, dmgl_mbc0_uninitialize, dmgl_mbc0_write, },
             };
 
         dmgl_test_initialize();
@@ -242,7 +442,11 @@ static dmgl_error_e dmgl_test_mapper_initialize(void)
                 && (g_test_mapper.mbc.cartridge == &g_test_mapper.mapper.cartridge)
                 && (g_test_mapper.mbc.context == g_test_mapper.mapper.context)
                 && (g_test_mapper.mbc.initialized == true)
+                && (g_test_mapper.mapper.handler.bank == handler[type].bank)
+                && (g_test_mapper.mapper.handler.fork == handler[type].fork)
                 && (g_test_mapper.mapper.handler.initialize == handler[type].initialize)
+                && (g_test_mapper.mapper.handler.map_read == handler[type].map_read)
+                && (g_test_mapper.mapper.handler.map_write == handler[type].map_write)
                 && (g_test_mapper.mapper.handler.read == handler[type].read)
                 && (g_test_mapper.mapper.handler.uninitialize == handler[type].uninitialize)
                 && (g_test_mapper.mapper.handler.write == handler[type].write))) {
@@ -257,6 +461,93 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test mapper load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_load(void)
+{
+    uint8_t data[16] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_mapper_load(&g_test_mapper.mapper, data) == DMGL_SUCCESS)
+            && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
+            && (g_test_mapper.cartridge.data == data))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_mapper.cartridge.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_mapper_load(&g_test_mapper.mapper, data) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test mapper map read.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_map_read(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+        dmgl_test_initialize();
+        g_test_mapper.mapper.context = (void *)1;
+        g_test_mapper.mapper.handler.map_read = dmgl_mbc_map_read;
+
+        if(DMGL_ASSERT((dmgl_mapper_map_read(&g_test_mapper.mapper, address) == g_test_mapper.mbc.page)
+                && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
+                && (g_test_mapper.mbc.context == g_test_mapper.mapper.context)
+                && (g_test_mapper.mbc.address == address))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test mapper map write.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_map_write(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+        dmgl_test_initialize();
+        g_test_mapper.mapper.context = (void *)1;
+        g_test_mapper.mapper.handler.map_write = dmgl_mbc_map_write;
+
+        if(DMGL_ASSERT((dmgl_mapper_map_write(&g_test_mapper.mapper, address) == g_test_mapper.mbc.page)
+                && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
+                && (g_test_mapper.mbc.context == g_test_mapper.mapper.context)
+                && (g_test_mapper.mbc.address == address))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test mapper read.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -297,14 +588,46 @@ static dmgl_error_e dmgl_test_mapper_reset(void)
 
     dmgl_test_initialize();
     g_test_mapper.mapper.handler.reset = dmgl_mbc_reset;
-    dmgl_mapper_reset(&g_test_mapper.mapper);
 
-    if(DMGL_ASSERT((g_test_mapper.cartridge.reset == true)
+    if(DMGL_ASSERT((dmgl_mapper_reset(&g_test_mapper.mapper) == DMGL_SUCCESS)
+            && (g_test_mapper.cartridge.reset == true)
             && (g_test_mapper.mbc.reset == true))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
+    g_test_mapper.cartridge.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_mapper_reset(&g_test_mapper.mapper) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test mapper save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mapper_save(void)
+{
+    uint8_t data[16] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_mapper.cartridge.length = sizeof(data);
+
+    if(DMGL_ASSERT((dmgl_mapper_save(&g_test_mapper.mapper, data) == sizeof(data))
+            && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
+            && (g_test_mapper.cartridge.data == data))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
 exit:
     DMGL_TEST_RESULT(result);
 
@@ -377,9 +700,9 @@ static dmgl_error_e dmgl_test_mapper_write(void)
         dmgl_test_initialize();
         g_test_mapper.mapper.context = (void *)1;
         g_test_mapper.mapper.handler.write = dmgl_mbc_write;
-        dmgl_mapper_write(&g_test_mapper.mapper, address, data);
 
-        if(DMGL_ASSERT((g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
+        if(DMGL_ASSERT((dmgl_mapper_write(&g_test_mapper.mapper, address, data) == (address & 1))
+                && (g_test_mapper.cartridge.cartridge == &g_test_mapper.mapper.cartridge)
                 && (g_test_mapper.mbc.context == g_test_mapper.mapper.context)
                 && (g_test_mapper.mbc.address == address)
                 && (g_test_mapper.mbc.value == data))) {
@@ -398,8 +721,10 @@ int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_mapper_checksum, dmgl_test_mapper_initialize, dmgl_test_mapper_read, dmgl_test_mapper_reset,
-        dmgl_test_mapper_title, dmgl_test_mapper_uninitialize, dmgl_test_mapper_write,
+        dmgl_test_mapper_bank, dmgl_test_mapper_checksum, dmgl_test_mapper_fault, dmgl_test_mapper_fork, dmgl_test_mapper_initialize,
+        dmgl_test_mapper_load, dmgl_test_mapper_map_read, dmgl_test_mapper_map_write, dmgl_test_mapper_read,
+        dmgl_test_mapper_reset, dmgl_test_mapper_save, dmgl_test_mapper_title, dmgl_test_mapper_uninitialize,
+        dmgl_test_mapper_write,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
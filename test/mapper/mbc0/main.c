@@ -40,6 +40,7 @@ typedef struct {
         size_t index;                       /*!< MBC0 mapper RAM bank index */
         uint16_t address;                   /*!< MBC0 mapper RAM address */
         uint8_t value;                      /*!< MBC0 mapper RAM value */
+        uint8_t data[8 * 1024];             /*!< MBC0 mapper RAM data */
     } ram;                                  /*!< MBC0 mapper RAM */
 
     struct {
@@ -47,6 +48,7 @@ typedef struct {
         size_t index;                       /*!< MBC0 mapper ROM bank index */
         uint16_t address;                   /*!< MBC0 mapper ROM address */
         uint8_t value;                      /*!< MBC0 mapper ROM value */
+        uint8_t data[16 * 1024];            /*!< MBC0 mapper ROM data */
     } rom;                                  /*!< MBC0 mapper ROM */
 } dmgl_test_mbc0_t;
 
@@ -56,6 +58,24 @@ static dmgl_test_mbc0_t g_test_mbc0 = {};   /*!< MBC0 mapper test context */
 extern "C" {
 #endif /* __cplusplus */
 
+const uint8_t *dmgl_cartridge_ram_map_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
+{
+    g_test_mbc0.ram.cartridge = cartridge;
+    g_test_mbc0.ram.index = index;
+    g_test_mbc0.ram.address = address;
+
+    return &g_test_mbc0.ram.data[address];
+}
+
+uint8_t *dmgl_cartridge_ram_map_write(dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
+{
+    g_test_mbc0.ram.cartridge = cartridge;
+    g_test_mbc0.ram.index = index;
+    g_test_mbc0.ram.address = address;
+
+    return &g_test_mbc0.ram.data[address];
+}
+
 uint8_t dmgl_cartridge_ram_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
 {
     g_test_mbc0.ram.cartridge = cartridge;
@@ -73,6 +93,15 @@ void dmgl_cartridge_ram_write(dmgl_cartridge_t *cartridge, size_t index, uint16_
     g_test_mbc0.ram.value = value;
 }
 
+const uint8_t *dmgl_cartridge_rom_map(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
+{
+    g_test_mbc0.rom.cartridge = cartridge;
+    g_test_mbc0.rom.index = index;
+    g_test_mbc0.rom.address = address;
+
+    return &g_test_mbc0.rom.data[address];
+}
+
 uint8_t dmgl_cartridge_rom_read(const dmgl_cartridge_t *cartridge, size_t index, uint16_t address)
 {
     g_test_mbc0.rom.cartridge = cartridge;
@@ -90,6 +119,53 @@ static inline void dmgl_test_initialize(void)
     memset(&g_test_mbc0, 0, sizeof(g_test_mbc0));
 }
 
+/*!
+ * @brief Test MBC0 mapper bank.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mbc0_bank(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+
+        if(DMGL_ASSERT(dmgl_mbc0_bank(g_test_mbc0.context, address) == (((address >= 0x4000) && (address <= 0x7FFF)) ? 1 : 0))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test MBC0 mapper fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mbc0_fork(void)
+{
+    void *fork = (void *)1;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_mbc0_fork(g_test_mbc0.context, &fork) == DMGL_SUCCESS)
+            && (fork == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test MBC0 mapper initialize.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -113,6 +189,112 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test MBC0 mapper map read.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mbc0_map_read(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+        const uint8_t *page;
+
+        dmgl_test_initialize();
+        page = dmgl_mbc0_map_read(&g_test_mbc0.cartridge, g_test_mbc0.context, address);
+
+        switch(address) {
+            case 0x0000 ... 0x3FFF:
+
+                if(DMGL_ASSERT((page == &g_test_mbc0.rom.data[address - 0x0000])
+                        && (g_test_mbc0.ram.cartridge == NULL)
+                        && (g_test_mbc0.rom.cartridge == &g_test_mbc0.cartridge)
+                        && (g_test_mbc0.rom.index == 0))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0x4000 ... 0x7FFF:
+
+                if(DMGL_ASSERT((page == &g_test_mbc0.rom.data[address - 0x4000])
+                        && (g_test_mbc0.ram.cartridge == NULL)
+                        && (g_test_mbc0.rom.cartridge == &g_test_mbc0.cartridge)
+                        && (g_test_mbc0.rom.index == 1))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0xA000 ... 0xBFFF:
+
+                if(DMGL_ASSERT((page == &g_test_mbc0.ram.data[address - 0xA000])
+                        && (g_test_mbc0.ram.cartridge == &g_test_mbc0.cartridge)
+                        && (g_test_mbc0.ram.index == 0)
+                        && (g_test_mbc0.rom.cartridge == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            default:
+
+                if(DMGL_ASSERT((page == NULL)
+                        && (g_test_mbc0.ram.cartridge == NULL)
+                        && (g_test_mbc0.rom.cartridge == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test MBC0 mapper map write.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_mbc0_map_write(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+        uint8_t *page;
+
+        dmgl_test_initialize();
+        page = dmgl_mbc0_map_write(&g_test_mbc0.cartridge, g_test_mbc0.context, address);
+
+        switch(address) {
+            case 0xA000 ... 0xBFFF:
+
+                if(DMGL_ASSERT((page == &g_test_mbc0.ram.data[address - 0xA000])
+                        && (g_test_mbc0.ram.cartridge == &g_test_mbc0.cartridge)
+                        && (g_test_mbc0.ram.index == 0)
+                        && (g_test_mbc0.rom.cartridge == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            default:
+
+                if(DMGL_ASSERT((page == NULL)
+                        && (g_test_mbc0.ram.cartridge == NULL)
+                        && (g_test_mbc0.rom.cartridge == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test MBC0 mapper read.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -266,7 +448,11 @@ static dmgl_error_e dmgl_test_mbc0_write(void)
 
     for(uint32_t address = 0x0000; address <= 0xFFFF; ++address, ++data) {
         dmgl_test_initialize();
-        dmgl_mbc0_write(&g_test_mbc0.cartridge, g_test_mbc0.context, address, data);
+
+        if(DMGL_ASSERT(dmgl_mbc0_write(&g_test_mbc0.cartridge, g_test_mbc0.context, address, data) == false)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
 
         switch(address) {
             case 0xA000 ... 0xBFFF:
@@ -310,7 +496,8 @@ int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_mbc0_initialize, dmgl_test_mbc0_read, dmgl_test_mbc0_reset, dmgl_test_mbc0_uninitialize,
+        dmgl_test_mbc0_bank, dmgl_test_mbc0_fork, dmgl_test_mbc0_initialize, dmgl_test_mbc0_map_read,
+        dmgl_test_mbc0_map_write, dmgl_test_mbc0_read, dmgl_test_mbc0_reset, dmgl_test_mbc0_uninitialize,
         dmgl_test_mbc0_write,
         };
 
@@ -40,6 +40,7 @@ typedef struct {
         size_t length;                          /*!< Memory bootloader length */
         uint16_t address;                       /*!< Memory bootloader address */
         uint8_t value;                          /*!< Memory bootloader value */
+        uint8_t page[256];                      /*!< Memory bootloader page */
         bool enabled;                           /*!< Memory bootloader enabled flag */
         bool initialized;                       /*!< Memory bootloader initialized flag */
         bool reset;                             /*!< Memory bootloader reset flag */
@@ -51,13 +52,35 @@ typedef struct {
         const uint8_t *data;                    /*!< Memory mapper data */
         size_t length;                          /*!< Memory mapper length */
         uint16_t address;                       /*!< Memory mapper address */
+        uint16_t bank;                          /*!< Memory mapper ROM bank */
         uint8_t value;                          /*!< Memory mapper value */
         uint8_t checksum;                       /*!< Memory mapper checksum */
+        uint8_t page[256];                      /*!< Memory mapper page */
         bool initialized;                       /*!< Memory mapper initialized flag */
         bool reset;                             /*!< Memory mapper reset flag */
+        bool changed;                           /*!< Memory mapper bank mapping changed flag */
+        bool fault;                             /*!< Memory mapper fault flag */
         const char *title;                      /*!< Memory mapper title string */
+        const uint8_t *state;                   /*!< Memory mapper state data */
         dmgl_error_e status;                    /*!< Memory mapper status */
     } mapper;                                   /*!< Memory mapper */
+
+    struct {
+        const dmgl_mapper_t *mapper;            /*!< Memory fork mapper context */
+        const dmgl_mapper_t *parent;            /*!< Memory fork mapper parent context */
+        dmgl_memory_t memory;                   /*!< Memory fork context */
+    } fork;                                     /*!< Memory fork */
+
+    struct {
+        dmgl_page_t internal[0x20];             /*!< Memory internal RAM pages */
+        dmgl_page_t video[0x20];                /*!< Memory video RAM pages */
+        dmgl_page_t copy;                       /*!< Memory page copy, written on first write to a shared page */
+        size_t allocate;                        /*!< Memory page allocate count */
+        size_t free;                            /*!< Memory page free count */
+        size_t share;                           /*!< Memory page share count */
+        bool shared;                            /*!< Memory page shared flag */
+        dmgl_error_e status;                    /*!< Memory page status */
+    } page;                                     /*!< Memory pages */
 } dmgl_test_memory_t;
 
 static dmgl_test_memory_t g_test_memory = {};   /*!< Memory test context */
@@ -89,6 +112,13 @@ dmgl_error_e dmgl_bootloader_initialize(dmgl_bootloader_t *bootloader, const uin
     return g_test_memory.bootloader.status;
 }
 
+const uint8_t *dmgl_bootloader_map(const dmgl_bootloader_t *bootloader, uint16_t address)
+{
+    g_test_memory.bootloader.bootloader = bootloader;
+
+    return g_test_memory.bootloader.enabled ? g_test_memory.bootloader.page : NULL;
+}
+
 uint8_t dmgl_bootloader_read(const dmgl_bootloader_t *bootloader, uint16_t address)
 {
     g_test_memory.bootloader.bootloader = bootloader;
@@ -108,6 +138,14 @@ void dmgl_bootloader_uninitialize(dmgl_bootloader_t *bootloader)
     g_test_memory.bootloader.initialized = false;
 }
 
+uint16_t dmgl_mapper_bank(const dmgl_mapper_t *mapper, uint16_t address)
+{
+    g_test_memory.mapper.mapper = mapper;
+    g_test_memory.mapper.address = address;
+
+    return g_test_memory.mapper.bank;
+}
+
 uint8_t dmgl_mapper_checksum(const dmgl_mapper_t *mapper)
 {
     g_test_memory.mapper.mapper = mapper;
@@ -115,6 +153,19 @@ uint8_t dmgl_mapper_checksum(const dmgl_mapper_t *mapper)
     return g_test_memory.mapper.checksum;
 }
 
+bool dmgl_mapper_fault(const dmgl_mapper_t *mapper)
+{
+    return g_test_memory.mapper.fault;
+}
+
+dmgl_error_e dmgl_mapper_fork(dmgl_mapper_t *mapper, const dmgl_mapper_t *parent)
+{
+    g_test_memory.fork.mapper = mapper;
+    g_test_memory.fork.parent = parent;
+
+    return g_test_memory.mapper.status;
+}
+
 dmgl_error_e dmgl_mapper_initialize(dmgl_mapper_t *mapper, const uint8_t *data, size_t length)
 {
     g_test_memory.mapper.mapper = mapper;
@@ -125,6 +176,28 @@ dmgl_error_e dmgl_mapper_initialize(dmgl_mapper_t *mapper, const uint8_t *data,
     return g_test_memory.mapper.status;
 }
 
+dmgl_error_e dmgl_mapper_load(dmgl_mapper_t *mapper, const uint8_t *data)
+{
+    g_test_memory.mapper.mapper = mapper;
+    g_test_memory.mapper.state = data;
+
+    return g_test_memory.mapper.status;
+}
+
+const uint8_t *dmgl_mapper_map_read(const dmgl_mapper_t *mapper, uint16_t address)
+{
+    g_test_memory.mapper.mapper = mapper;
+
+    return g_test_memory.mapper.page;
+}
+
+uint8_t *dmgl_mapper_map_write(dmgl_mapper_t *mapper, uint16_t address)
+{
+    g_test_memory.mapper.mapper = mapper;
+
+    return (address >= 0xA000) ? g_test_memory.mapper.page : NULL;
+}
+
 uint8_t dmgl_mapper_read(const dmgl_mapper_t *mapper, uint16_t address)
 {
     g_test_memory.mapper.mapper = mapper;
@@ -133,9 +206,19 @@ uint8_t dmgl_mapper_read(const dmgl_mapper_t *mapper, uint16_t address)
     return g_test_memory.mapper.value;
 }
 
-void dmgl_mapper_reset(dmgl_mapper_t *mapper)
+dmgl_error_e dmgl_mapper_reset(dmgl_mapper_t *mapper)
 {
     g_test_memory.mapper.reset = true;
+
+    return g_test_memory.mapper.status;
+}
+
+size_t dmgl_mapper_save(const dmgl_mapper_t *mapper, uint8_t *data)
+{
+    g_test_memory.mapper.mapper = mapper;
+    g_test_memory.mapper.state = data;
+
+    return g_test_memory.mapper.length;
 }
 
 const char *dmgl_mapper_title(const dmgl_mapper_t *mapper)
@@ -151,11 +234,96 @@ void dmgl_mapper_uninitialize(dmgl_mapper_t *mapper)
     g_test_memory.mapper.initialized = false;
 }
 
-void dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value)
+bool dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value)
 {
     g_test_memory.mapper.mapper = mapper;
     g_test_memory.mapper.address = address;
     g_test_memory.mapper.value = value;
+
+    return g_test_memory.mapper.changed;
+}
+
+void dmgl_pixel_decode(const uint8_t *data, uint8_t *index)
+{
+
+    for(uint8_t y = 0; y < 8; ++y, data += 2) {
+
+        for(uint8_t x = 0; x < 8; ++x) {
+            *(index++) = (((data[1] >> (7 - x)) & 1) << 1) | ((data[0] >> (7 - x)) & 1);
+        }
+    }
+}
+
+dmgl_error_e dmgl_page_allocate_arena(dmgl_page_t **page, size_t count, uint8_t value)
+{
+
+    for(size_t index = 0; (g_test_memory.page.status == DMGL_SUCCESS) && (index < count); ++index) {
+        memset(page[index]->data, value, sizeof(page[index]->data));
+        ++g_test_memory.page.allocate;
+    }
+
+    return g_test_memory.page.status;
+}
+
+void dmgl_page_free(dmgl_page_t *page)
+{
+    ++g_test_memory.page.free;
+}
+
+dmgl_page_t *dmgl_page_share(dmgl_page_t *page)
+{
+    ++g_test_memory.page.share;
+
+    return page;
+}
+
+bool dmgl_page_shared(const dmgl_page_t *page)
+{
+    return g_test_memory.page.shared;
+}
+
+uint8_t *dmgl_page_write(dmgl_page_t **page)
+{
+    uint8_t *result = NULL;
+
+    if(g_test_memory.page.status == DMGL_SUCCESS) {
+
+        if(g_test_memory.page.shared) {
+            memcpy(g_test_memory.page.copy.data, (*page)->data, sizeof(g_test_memory.page.copy.data));
+            *page = &g_test_memory.page.copy;
+            g_test_memory.page.shared = false;
+        }
+
+        result = (*page)->data;
+    }
+
+    return result;
+}
+
+/*!
+ * @brief Query test memory RAM page byte.
+ * @param[in] address Byte address [8000-9FFF, C000-FDFF]
+ * @return Pointer to byte
+ */
+static inline uint8_t *dmgl_test_data(uint16_t address)
+{
+    uint8_t *result = NULL;
+
+    switch(address) {
+        case 0x8000 ... 0x9FFF:
+            result = &g_test_memory.page.video[(address - 0x8000) >> 8].data[address & 0xFF];
+            break;
+        case 0xC000 ... 0xDFFF:
+            result = &g_test_memory.page.internal[(address - 0xC000) >> 8].data[address & 0xFF];
+            break;
+        case 0xE000 ... 0xFDFF:
+            result = &g_test_memory.page.internal[(address - 0xE000) >> 8].data[address & 0xFF];
+            break;
+        default:
+            break;
+    }
+
+    return result;
 }
 
 /*!
@@ -164,6 +332,43 @@ void dmgl_mapper_write(dmgl_mapper_t *mapper, uint16_t address, uint8_t value)
 static inline void dmgl_test_initialize(void)
 {
     memset(&g_test_memory, 0, sizeof(g_test_memory));
+
+    for(uint32_t page = 0; page < 0x20; ++page) {
+        g_test_memory.memory.internal[page] = &g_test_memory.page.internal[page];
+        g_test_memory.memory.video[page] = &g_test_memory.page.video[page];
+    }
+}
+
+/*!
+ * @brief Test memory bank.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_bank(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0x0000; address <= 0xFFFF; ++address) {
+        dmgl_test_initialize();
+        g_test_memory.bootloader.enabled = true;
+        g_test_memory.mapper.bank = 2;
+
+        if(DMGL_ASSERT(dmgl_memory_bank(&g_test_memory.memory, address) == (((address >= 0x0100) && (address <= 0x7FFF)) ? 2 : 0))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        g_test_memory.bootloader.enabled = false;
+
+        if(DMGL_ASSERT(dmgl_memory_bank(&g_test_memory.memory, address) == ((address <= 0x7FFF) ? 2 : 0))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
 }
 
 /*!
@@ -189,6 +394,104 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test memory fault.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_fault(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_memory_write(&g_test_memory.memory, 0xC000, 0x5A);
+
+    if(DMGL_ASSERT((dmgl_memory_fault(&g_test_memory.memory) == false)
+            && (*dmgl_test_data(0xC000) == 0x5A))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_memory.page.status = DMGL_FAILURE;
+    dmgl_memory_write(&g_test_memory.memory, 0xC000, 0xA5);
+
+    if(DMGL_ASSERT((dmgl_memory_fault(&g_test_memory.memory) == true)
+            && (*dmgl_test_data(0xC000) == 0x5A))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test_memory.mapper.fault = true;
+
+    if(DMGL_ASSERT(dmgl_memory_fault(&g_test_memory.memory) == true)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test memory fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_fork(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_memory.mapper.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_memory_fork(&g_test_memory.fork.memory, &g_test_memory.memory) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    dmgl_memory_reset(&g_test_memory.memory);
+    g_test_memory.page.shared = true;
+
+    if(DMGL_ASSERT((dmgl_memory_fork(&g_test_memory.fork.memory, &g_test_memory.memory) == DMGL_SUCCESS)
+            && (g_test_memory.fork.mapper == &g_test_memory.fork.memory.mapper)
+            && (g_test_memory.fork.parent == &g_test_memory.memory.mapper)
+            && (g_test_memory.page.share == 0x40)
+            && (g_test_memory.memory.page.write[0xC0] == NULL)
+            && (g_test_memory.fork.memory.page.read[0xC0] == g_test_memory.page.internal[0].data)
+            && (g_test_memory.fork.memory.page.write[0xC0] == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(uint32_t page = 0; page < 0x20; ++page) {
+
+        if(DMGL_ASSERT((g_test_memory.fork.memory.internal[page] == &g_test_memory.page.internal[page])
+                && (g_test_memory.fork.memory.video[page] == &g_test_memory.page.video[page]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    dmgl_memory_write(&g_test_memory.fork.memory, 0xC000, 0x5A);
+
+    if(DMGL_ASSERT((g_test_memory.fork.memory.internal[0] == &g_test_memory.page.copy)
+            && (g_test_memory.fork.memory.page.read[0xC0] == g_test_memory.page.copy.data)
+            && (g_test_memory.fork.memory.page.write[0xC0] == g_test_memory.page.copy.data)
+            && (g_test_memory.fork.memory.page.write[0xE0] == g_test_memory.page.copy.data)
+            && (g_test_memory.page.copy.data[0] == 0x5A)
+            && (*dmgl_test_data(0xC000) == 0xFF))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test memory has bootloader.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -245,6 +548,14 @@ static dmgl_error_e dmgl_test_memory_initialize(void)
         goto exit;
     }
 
+    dmgl_test_initialize();
+    g_test_memory.page.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_memory_initialize(&g_test_memory.memory, &context) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
     dmgl_test_initialize();
     context.bootloader.data = (void *)1;
     context.bootloader.length = 256;
@@ -259,7 +570,63 @@ static dmgl_error_e dmgl_test_memory_initialize(void)
             && (g_test_memory.mapper.mapper == &g_test_memory.memory.mapper)
             && (g_test_memory.mapper.data == (void *)2)
             && (g_test_memory.mapper.length == 512)
-            && (g_test_memory.mapper.initialized == true))) {
+            && (g_test_memory.mapper.initialized == true)
+            && (g_test_memory.page.allocate == 0x40))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test memory load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_load(void)
+{
+    static uint8_t data[0x4200];
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length = 1 + sizeof(g_test_memory.memory.high) + (0x20 * DMGL_PAGE_LENGTH)
+        + sizeof(g_test_memory.memory.sprite) + (0x20 * DMGL_PAGE_LENGTH);
+
+    for(uint8_t enabled = 0; enabled < 2; ++enabled) {
+        dmgl_test_initialize();
+        g_test_memory.mapper.length = 16;
+        g_test_memory.bootloader.enabled = true;
+        memset(data, 0x5A, sizeof(data));
+        data[0] = enabled;
+
+        if(DMGL_ASSERT((dmgl_memory_load(&g_test_memory.memory, data) == DMGL_SUCCESS)
+                && (g_test_memory.bootloader.reset == enabled)
+                && (g_test_memory.bootloader.enabled == enabled)
+                && (g_test_memory.mapper.state == (data + length))
+                && (g_test_memory.memory.high[0] == 0x5A)
+                && (*dmgl_test_data(0xC000) == 0x5A)
+                && (g_test_memory.memory.sprite[0] == 0x5A)
+                && (*dmgl_test_data(0x8000) == 0x5A)
+                && (g_test_memory.memory.tile.dirty[0] == true)
+                && (g_test_memory.memory.page.read[0xC0] == g_test_memory.page.internal[0].data))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    g_test_memory.mapper.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_memory_load(&g_test_memory.memory, data) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test_memory.page.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_memory_load(&g_test_memory.memory, data) == DMGL_FAILURE)
+            && (g_test_memory.mapper.state == NULL))) {
         result = DMGL_FAILURE;
         goto exit;
     }
@@ -305,7 +672,7 @@ static dmgl_error_e dmgl_test_memory_read(void)
                 }
                 break;
             case 0x8000 ... 0x9FFF:
-                g_test_memory.memory.video[address - 0x8000] = data;
+                *dmgl_test_data(address) = data;
 
                 if(DMGL_ASSERT(dmgl_memory_read(&g_test_memory.memory, address) == data)) {
                     result = DMGL_FAILURE;
@@ -313,7 +680,7 @@ static dmgl_error_e dmgl_test_memory_read(void)
                 }
                 break;
             case 0xC000 ... 0xDFFF:
-                g_test_memory.memory.internal[address - 0xC000] = data;
+                *dmgl_test_data(address) = data;
 
                 if(DMGL_ASSERT(dmgl_memory_read(&g_test_memory.memory, address) == data)) {
                     result = DMGL_FAILURE;
@@ -321,7 +688,7 @@ static dmgl_error_e dmgl_test_memory_read(void)
                 }
                 break;
             case 0xE000 ... 0xFDFF:
-                g_test_memory.memory.internal[address - 0xE000] = data;
+                *dmgl_test_data(address) = data;
 
                 if(DMGL_ASSERT(dmgl_memory_read(&g_test_memory.memory, address) == data)) {
                     result = DMGL_FAILURE;
@@ -372,14 +739,206 @@ static dmgl_error_e dmgl_test_memory_reset(void)
     dmgl_error_e result = DMGL_SUCCESS;
 
     dmgl_test_initialize();
-    dmgl_memory_reset(&g_test_memory.memory);
+    g_test_memory.bootloader.enabled = true;
 
-    if(DMGL_ASSERT((g_test_memory.bootloader.reset == true)
+    if(DMGL_ASSERT((dmgl_memory_reset(&g_test_memory.memory) == DMGL_SUCCESS)
+            && (g_test_memory.bootloader.reset == true)
             && (g_test_memory.mapper.reset == true))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
+    for(uint32_t address = 0x0000; address <= 0xFFFF; address += 0x0100) {
+        const uint8_t *read = g_test_memory.memory.page.read[address >> 8];
+        const uint8_t *write = g_test_memory.memory.page.write[address >> 8];
+
+        switch(address) {
+            case 0x0000 ... 0x00FF:
+
+                if(DMGL_ASSERT((read == g_test_memory.bootloader.page)
+                        && (write == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0x0100 ... 0x7FFF:
+
+                if(DMGL_ASSERT((read == g_test_memory.mapper.page)
+                        && (write == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0x8000 ... 0x97FF:
+
+                if(DMGL_ASSERT((read == dmgl_test_data(address))
+                        && (write == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0x9800 ... 0x9FFF:
+
+                if(DMGL_ASSERT((read == dmgl_test_data(address))
+                        && (write == read))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0xA000 ... 0xBFFF:
+
+                if(DMGL_ASSERT((read == g_test_memory.mapper.page)
+                        && (write == g_test_memory.mapper.page))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0xC000 ... 0xDFFF:
+
+                if(DMGL_ASSERT((read == dmgl_test_data(address))
+                        && (write == read))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0xE000 ... 0xFDFF:
+
+                if(DMGL_ASSERT((read == dmgl_test_data(address))
+                        && (write == read))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            default:
+
+                if(DMGL_ASSERT((read == NULL)
+                        && (write == NULL))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+        }
+    }
+
+    dmgl_test_initialize();
+    g_test_memory.mapper.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_memory_reset(&g_test_memory.memory) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    g_test_memory.page.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_memory_reset(&g_test_memory.memory) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test memory save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_save(void)
+{
+    static uint8_t data[0x4200];
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length = 1 + sizeof(g_test_memory.memory.high) + (0x20 * DMGL_PAGE_LENGTH)
+        + sizeof(g_test_memory.memory.sprite) + (0x20 * DMGL_PAGE_LENGTH);
+
+    dmgl_test_initialize();
+    g_test_memory.mapper.length = 16;
+    g_test_memory.bootloader.enabled = true;
+    memset(g_test_memory.memory.high, 0x11, sizeof(g_test_memory.memory.high));
+    memset(g_test_memory.page.internal, 0x22, sizeof(g_test_memory.page.internal));
+    memset(g_test_memory.memory.sprite, 0x33, sizeof(g_test_memory.memory.sprite));
+    memset(g_test_memory.page.video, 0x44, sizeof(g_test_memory.page.video));
+
+    if(DMGL_ASSERT((dmgl_memory_save(&g_test_memory.memory, NULL) == (length + 16))
+            && (g_test_memory.mapper.state == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    if(DMGL_ASSERT((dmgl_memory_save(&g_test_memory.memory, data) == (length + 16))
+            && (g_test_memory.mapper.state == (data + length))
+            && (data[0] == true)
+            && (data[1] == 0x11)
+            && (data[1 + sizeof(g_test_memory.memory.high)] == 0x22)
+            && (data[1 + sizeof(g_test_memory.memory.high) + (0x20 * DMGL_PAGE_LENGTH)] == 0x33)
+            && (data[length - 1] == 0x44))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test memory tile.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_tile(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint16_t tile = 0; tile < 384; ++tile) {
+        const uint8_t *index;
+
+        dmgl_test_initialize();
+        dmgl_memory_reset(&g_test_memory.memory);
+
+        for(uint8_t y = 0; y < 8; ++y) {
+            dmgl_memory_write(&g_test_memory.memory, 0x8000 + (tile * 16) + (y * 2), 0xF0 >> (y & 3));
+            dmgl_memory_write(&g_test_memory.memory, 0x8000 + (tile * 16) + (y * 2) + 1, 0x0F << (y & 3));
+        }
+
+        index = dmgl_memory_tile(&g_test_memory.memory, tile);
+
+        for(uint8_t y = 0; y < 8; ++y) {
+            uint8_t low = 0xF0 >> (y & 3), high = 0x0F << (y & 3);
+
+            for(uint8_t x = 0; x < 8; ++x) {
+
+                if(DMGL_ASSERT(index[(y * 8) + x] == ((((high >> (7 - x)) & 1) << 1) | ((low >> (7 - x)) & 1)))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+            }
+        }
+
+        if(DMGL_ASSERT(g_test_memory.memory.tile.dirty[tile] == false)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        *dmgl_test_data(0x8000 + (tile * 16)) = 0x00;
+
+        if(DMGL_ASSERT((dmgl_memory_tile(&g_test_memory.memory, tile) == index)
+                && (index[0] == 1))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        dmgl_memory_write(&g_test_memory.memory, 0x8000 + (tile * 16), 0x00);
+
+        if(DMGL_ASSERT((g_test_memory.memory.tile.dirty[tile] == true)
+                && (dmgl_memory_tile(&g_test_memory.memory, tile)[0] == 0))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
 exit:
     DMGL_TEST_RESULT(result);
 
@@ -425,7 +984,8 @@ static dmgl_error_e dmgl_test_memory_uninitialize(void)
     if(DMGL_ASSERT((g_test_memory.bootloader.bootloader == &g_test_memory.memory.bootloader)
             && (g_test_memory.bootloader.initialized == false)
             && (g_test_memory.mapper.mapper == &g_test_memory.memory.mapper)
-            && (g_test_memory.mapper.initialized == false))) {
+            && (g_test_memory.mapper.initialized == false)
+            && (g_test_memory.page.free == 0x40))) {
         result = DMGL_FAILURE;
         goto exit;
     }
@@ -451,23 +1011,31 @@ static dmgl_error_e dmgl_test_memory_write(void)
         dmgl_memory_write(&g_test_memory.memory, address, data);
 
         switch(address) {
-            case 0x8000 ... 0x9FFF:
+            case 0x8000 ... 0x97FF:
+
+                if(DMGL_ASSERT((*dmgl_test_data(address) == data)
+                        && (g_test_memory.memory.tile.dirty[(address - 0x8000) >> 4] == true))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0x9800 ... 0x9FFF:
 
-                if(DMGL_ASSERT(g_test_memory.memory.video[address - 0x8000] == data)) {
+                if(DMGL_ASSERT(*dmgl_test_data(address) == data)) {
                     result = DMGL_FAILURE;
                     goto exit;
                 }
                 break;
             case 0xC000 ... 0xDFFF:
 
-                if(DMGL_ASSERT(g_test_memory.memory.internal[address - 0xC000] == data)) {
+                if(DMGL_ASSERT(*dmgl_test_data(address) == data)) {
                     result = DMGL_FAILURE;
                     goto exit;
                 }
                 break;
             case 0xE000 ... 0xFDFF:
 
-                if(DMGL_ASSERT(g_test_memory.memory.internal[address - 0xE000] == data)) {
+                if(DMGL_ASSERT(*dmgl_test_data(address) == data)) {
                     result = DMGL_FAILURE;
                     goto exit;
                 }
@@ -489,7 +1057,8 @@ static dmgl_error_e dmgl_test_memory_write(void)
             case 0xFF50:
 
                 if(DMGL_ASSERT((g_test_memory.bootloader.enabled == false)
-                        && (g_test_memory.bootloader.bootloader == &g_test_memory.memory.bootloader))) {
+                        && (g_test_memory.bootloader.bootloader == &g_test_memory.memory.bootloader)
+                        && (g_test_memory.memory.page.read[0x00] == g_test_memory.mapper.page))) {
                     result = DMGL_FAILURE;
                     goto exit;
                 }
@@ -512,12 +1081,64 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test memory write page table update.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_memory_write_map(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_memory.memory.page.read[0x40] = NULL;
+    g_test_memory.memory.page.read[0xA0] = NULL;
+    g_test_memory.memory.page.write[0xA0] = NULL;
+    dmgl_memory_write(&g_test_memory.memory, 0x2000, 0x01);
+
+    if(DMGL_ASSERT(g_test_memory.memory.page.read[0x40] == NULL)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_memory.mapper.changed = true;
+    dmgl_memory_write(&g_test_memory.memory, 0xFF05, 0x01);
+
+    if(DMGL_ASSERT((g_test_memory.memory.page.read[0x40] == NULL)
+            && (g_test_memory.memory.page.read[0xA0] == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_memory_write(&g_test_memory.memory, 0x2000, 0x01);
+
+    if(DMGL_ASSERT(g_test_memory.memory.page.read[0x40] == g_test_memory.mapper.page)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_memory.mapper.changed = false;
+    dmgl_memory_write(&g_test_memory.memory, 0xA010, 0x01);
+
+    if(DMGL_ASSERT((g_test_memory.memory.page.read[0xA0] == g_test_memory.mapper.page)
+            && (g_test_memory.memory.page.write[0xA0] == g_test_memory.mapper.page))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_memory_checksum, dmgl_test_memory_has_bootloader, dmgl_test_memory_initialize, dmgl_test_memory_read,
-        dmgl_test_memory_reset, dmgl_test_memory_title, dmgl_test_memory_uninitialize, dmgl_test_memory_write,
+        dmgl_test_memory_bank, dmgl_test_memory_checksum, dmgl_test_memory_fault, dmgl_test_memory_fork, dmgl_test_memory_has_bootloader,
+        dmgl_test_memory_initialize, dmgl_test_memory_load, dmgl_test_memory_read, dmgl_test_memory_reset,
+        dmgl_test_memory_save, dmgl_test_memory_tile, dmgl_test_memory_title, dmgl_test_memory_uninitialize,
+        dmgl_test_memory_write, dmgl_test_memory_write_map,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
@@ -0,0 +1,403 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Common page test application.
+ */
+
+#include <page.h>
+#include <test.h>
+
+/*!
+ * @struct dmgl_test_page_t
+ * @brief Page test context.
+ */
+typedef struct {
+    dmgl_page_t *page;                      /*!< Page */
+    dmgl_page_t *share;                     /*!< Page share */
+    dmgl_page_t *arena[4];                  /*!< Page arena pages */
+
+    struct {
+        dmgl_error_e status;                /*!< Page buffer status */
+        size_t allocate;                    /*!< Page buffer allocate count */
+        size_t free;                        /*!< Page buffer free count */
+    } buffer;                               /*!< Page buffer */
+} dmgl_test_page_t;
+
+static dmgl_test_page_t g_test_page = {};   /*!< Page test context */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void *dmgl_buffer_allocate(size_t length)
+{
+    void *result = NULL;
+
+    if(g_test_page.buffer.status == DMGL_SUCCESS) {
+        result = calloc(length, sizeof(uint8_t));
+        ++g_test_page.buffer.allocate;
+    }
+
+    return result;
+}
+
+dmgl_buffer_arena_t *dmgl_buffer_arena_allocate(size_t length)
+{
+    dmgl_buffer_arena_t *result;
+
+    if((result = dmgl_buffer_allocate(sizeof(*result) + length))) {
+        atomic_init(&result->reference, 1);
+        result->length = length;
+    }
+
+    return result;
+}
+
+void *dmgl_buffer_arena_claim(dmgl_buffer_arena_t *arena, size_t length)
+{
+    void *result = &arena->data[arena->offset];
+
+    atomic_fetch_add(&arena->reference, 1);
+    arena->offset += length;
+
+    return result;
+}
+
+void dmgl_buffer_arena_release(dmgl_buffer_arena_t *arena)
+{
+
+    if(atomic_fetch_sub(&arena->reference, 1) == 1) {
+        dmgl_buffer_free(arena);
+    }
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+    ++g_test_page.buffer.free;
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+/*!
+ * @brief Initilalize test context.
+ */
+static inline void dmgl_test_initialize(void)
+{
+    dmgl_page_free(g_test_page.page);
+    dmgl_page_free(g_test_page.share);
+
+    for(size_t index = 0; index < 4; ++index) {
+        dmgl_page_free(g_test_page.arena[index]);
+    }
+
+    memset(&g_test_page, 0, sizeof(g_test_page));
+}
+
+/*!
+ * @brief Test page allocate.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_page_allocate(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_page.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_page_allocate(&g_test_page.page, 0xFF) == DMGL_FAILURE)
+            && (g_test_page.page == NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_page_allocate(&g_test_page.page, 0x5A) == DMGL_SUCCESS)
+            && (g_test_page.page != NULL)
+            && (g_test_page.page->reference == 1))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < DMGL_PAGE_LENGTH; ++index) {
+
+        if(DMGL_ASSERT(g_test_page.page->data[index] == 0x5A)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test page arena allocate.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_page_allocate_arena(void)
+{
+    dmgl_page_t *page;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_page.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_page_allocate_arena(g_test_page.arena, 4, 0xFF) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_page_allocate_arena(g_test_page.arena, 4, 0x5A) == DMGL_SUCCESS)
+            && (g_test_page.buffer.allocate == 1)
+            && (g_test_page.arena[0]->arena != NULL)
+            && (g_test_page.arena[0]->arena->reference == 4))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 0; index < 4; ++index) {
+
+        if(DMGL_ASSERT((g_test_page.arena[index]->reference == 1)
+                && (g_test_page.arena[index]->arena == g_test_page.arena[0]->arena)
+                && (g_test_page.arena[index] == &g_test_page.arena[0][index]))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        for(size_t offset = 0; offset < DMGL_PAGE_LENGTH; ++offset) {
+
+            if(DMGL_ASSERT(g_test_page.arena[index]->data[offset] == 0x5A)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+    page = g_test_page.arena[0];
+    g_test_page.share = dmgl_page_share(page);
+    dmgl_page_write(&g_test_page.arena[0]);
+
+    if(DMGL_ASSERT((g_test_page.arena[0] != page)
+            && (g_test_page.arena[0]->arena == NULL)
+            && (page->arena->reference == 4))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(size_t index = 1; index < 4; ++index) {
+        dmgl_page_free(g_test_page.arena[index]);
+        g_test_page.arena[index] = NULL;
+    }
+
+    if(DMGL_ASSERT((g_test_page.buffer.free == 0)
+            && (page->arena->reference == 1))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_page_free(g_test_page.share);
+    g_test_page.share = NULL;
+
+    if(DMGL_ASSERT(g_test_page.buffer.free == 1)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test page free.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_page_free(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_page_free(NULL);
+
+    if(DMGL_ASSERT(g_test_page.buffer.free == 0)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_page_allocate(&g_test_page.page, 0xFF);
+    dmgl_page_share(g_test_page.page);
+    dmgl_page_free(g_test_page.page);
+
+    if(DMGL_ASSERT((g_test_page.buffer.free == 0)
+            && (g_test_page.page->reference == 1))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_page_free(g_test_page.page);
+    g_test_page.page = NULL;
+
+    if(DMGL_ASSERT(g_test_page.buffer.free == 1)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test page share.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_page_share(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_page_allocate(&g_test_page.page, 0xFF);
+
+    if(DMGL_ASSERT(((g_test_page.share = dmgl_page_share(g_test_page.page)) == g_test_page.page)
+            && (g_test_page.page->reference == 2))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test page shared.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_page_shared(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_page_allocate(&g_test_page.page, 0xFF);
+
+    if(DMGL_ASSERT(dmgl_page_shared(g_test_page.page) == false)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_page.share = dmgl_page_share(g_test_page.page);
+
+    if(DMGL_ASSERT(dmgl_page_shared(g_test_page.page) == true)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test page write.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_page_write(void)
+{
+    dmgl_page_t *page;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_page_allocate(&g_test_page.page, 0x5A);
+    page = g_test_page.page;
+
+    if(DMGL_ASSERT((dmgl_page_write(&g_test_page.page) == page->data)
+            && (g_test_page.page == page)
+            && (g_test_page.buffer.allocate == 1))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_page.share = dmgl_page_share(g_test_page.page);
+    g_test_page.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT((dmgl_page_write(&g_test_page.page) == NULL)
+            && (g_test_page.page == page)
+            && (page->reference == 2))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_page.buffer.status = DMGL_SUCCESS;
+
+    if(DMGL_ASSERT((dmgl_page_write(&g_test_page.page) == g_test_page.page->data)
+            && (g_test_page.page != page)
+            && (g_test_page.page->reference == 1)
+            && (g_test_page.page->data[0] == 0x5A)
+            && (page->reference == 1)
+            && (g_test_page.buffer.allocate == 2))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_page_allocate, dmgl_test_page_allocate_arena, dmgl_test_page_free, dmgl_test_page_share, dmgl_test_page_shared,
+        dmgl_test_page_write,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    dmgl_test_initialize();
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,124 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Common pixel test application.
+ */
+
+#include <pixel.h>
+#include <test.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Test common pixel decode.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_pixel_decode(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t value = 0; value <= 0xFFFF; ++value) {
+        uint8_t data[16], index[64];
+
+        for(uint8_t offset = 0; offset < sizeof(data); ++offset) {
+            data[offset] = (offset & 1) ? ((value >> 8) ^ (offset * 0x1D)) : (value ^ (offset * 0x3B));
+        }
+
+        dmgl_pixel_decode(data, index);
+
+        for(uint8_t y = 0; y < 8; ++y) {
+
+            for(uint8_t x = 0; x < 8; ++x) {
+
+                if(DMGL_ASSERT(index[(y * 8) + x] == ((((data[(y * 2) + 1] >> (7 - x)) & 1) << 1) | ((data[y * 2] >> (7 - x)) & 1)))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+            }
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common pixel expand.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_pixel_expand(void)
+{
+    uint8_t color[167];
+    uint32_t pixel[167];
+    dmgl_error_e result = DMGL_SUCCESS;
+    const uint32_t palette[] = {
+        0xFF081820, 0xFF346856, 0xFF88C070, 0xFFE0F8D0,
+        };
+
+    for(size_t index = 0; index < sizeof(color); ++index) {
+        color[index] = (index * 7) % 8;
+    }
+
+    for(size_t length = 0; length <= sizeof(color); ++length) {
+        memset(pixel, 0, sizeof(pixel));
+        dmgl_pixel_expand(color, palette, pixel, length);
+
+        for(size_t index = 0; index < sizeof(color); ++index) {
+
+            if(DMGL_ASSERT(pixel[index] == ((index < length) ? palette[color[index] & 3] : 0))) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_pixel_decode, dmgl_test_pixel_expand,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
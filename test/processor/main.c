@@ -37,6 +37,7 @@ typedef struct {
     dmgl_processor_t expected;                      /*!< Processor expected context */
 
     struct {
+        const dmgl_bus_t *context;                  /*!< Processor bus context */
         uint16_t address;                           /*!< Processor bus address */
         uint8_t value[0x10000];                     /*!< Processor bus value */
     } bus;                                          /*!< Processor bus */
@@ -48,19 +49,62 @@ static dmgl_test_processor_t g_test_processor = {}; /*!< Processor test context
 extern "C" {
 #endif /* __cplusplus */
 
-uint8_t dmgl_bus_read(uint16_t address)
+void *dmgl_buffer_allocate(size_t length)
 {
+    return calloc(length, sizeof(uint8_t));
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+uint32_t dmgl_bus_block(const dmgl_bus_t *bus, uint16_t address)
+{
+    g_test_processor.bus.context = bus;
+
+    return (address < 0x8000) ? address : UINT32_MAX;
+}
+
+uint8_t dmgl_bus_read(const dmgl_bus_t *bus, uint16_t address)
+{
+    g_test_processor.bus.context = bus;
     g_test_processor.bus.address = address;
 
     return g_test_processor.bus.value[address];
 }
 
-void dmgl_bus_write(uint16_t address, uint8_t value)
+void dmgl_bus_write(dmgl_bus_t *bus, uint16_t address, uint8_t value)
 {
+    g_test_processor.bus.context = bus;
     g_test_processor.bus.address = address;
     g_test_processor.bus.value[address] = value;
 }
 
+/*!
+ * @brief Execute test program at 0x0100 from AF register.
+ * @param[in] af AF register
+ * @param[in] cycles Program length, in machine cycles
+ * @return AF register after the program
+ */
+static uint16_t dmgl_test_execute(uint16_t af, uint32_t cycles)
+{
+    g_test_processor.processor.bank.af.word = af;
+    g_test_processor.processor.bank.pc.word = 0x0100;
+    dmgl_processor_reset(&g_test_processor.processor);
+
+    for(uint32_t cycle = 0; cycle < cycles; ++cycle) {
+        dmgl_processor_clock(&g_test_processor.processor);
+    }
+
+    return g_test_processor.processor.bank.af.word;
+}
+
 /*!
  * @brief Initilalize test context.
  */
@@ -77,7 +121,7 @@ static inline dmgl_error_e dmgl_test_match(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
 
-    if(DMGL_ASSERT(g_test_processor.processor.cycle == g_test_processor.expected.cycle)) {
+    if(DMGL_ASSERT(g_test_processor.processor.bus == g_test_processor.expected.bus)) {
         result = DMGL_FAILURE;
         goto exit;
     }
@@ -297,33 +341,150 @@ exit:
 }
 
 /*!
- * @brief Test processor clock.
+ * @brief Test processor ALU instructions match reference arithmetic.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
  */
-static dmgl_error_e dmgl_test_processor_clock(void)
+static dmgl_error_e dmgl_test_processor_alu(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
 
     dmgl_test_initialize();
-    g_test_processor.processor.cycle = 0;
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, true, 0x00);
+
+    for(uint32_t operation = 0; operation < 8; ++operation) {
+        g_test_processor.bus.value[0x0100] = 0xC6 | (operation << 3);
+
+        for(uint32_t carry = 0; carry < 2; ++carry) {
+
+            for(uint32_t left = 0; left < 256; ++left) {
+
+                for(uint32_t right = 0; right < 256; ++right) {
+                    uint32_t carry_in = ((operation == 1) || (operation == 3)) ? carry : 0, flag = 0;
+                    int32_t value = 0;
+
+                    switch(operation) {
+                        case 0: /* ADD */
+                        case 1: /* ADC */
+                            value = left + right + carry_in;
+                            flag = ((((left & 0x0F) + (right & 0x0F) + carry_in) > 0x0F) ? 0x20 : 0) | ((value > 0xFF) ? 0x10 : 0);
+                            break;
+                        case 2: /* SUB */
+                        case 3: /* SBC */
+                        case 7: /* CP */
+                            value = (int32_t)left - (int32_t)right - (int32_t)carry_in;
+                            flag = 0x40 | (((left & 0x0F) < ((right & 0x0F) + carry_in)) ? 0x20 : 0) | ((value < 0) ? 0x10 : 0);
+                            break;
+                        case 4: /* AND */
+                            value = left & right;
+                            flag = 0x20;
+                            break;
+                        case 5: /* XOR */
+                            value = left ^ right;
+                            break;
+                        case 6: /* OR */
+                            value = left | right;
+                            break;
+                        default:
+                            break;
+                    }
 
-    if(DMGL_ASSERT((dmgl_processor_clock(&g_test_processor.processor) == DMGL_SUCCESS)
-            && (g_test_processor.processor.cycle == 3))) {
-        result = DMGL_FAILURE;
-        goto exit;
+                    flag |= !(value & 0xFF) ? 0x80 : 0;
+
+                    if(operation == 7) {
+                        value = left;
+                    }
+
+                    g_test_processor.bus.value[0x0101] = right;
+
+                    if(DMGL_ASSERT(dmgl_test_execute((left << 8) | (carry ? 0x10 : 0), 2) == (((value & 0xFF) << 8) | flag))) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                }
+            }
+        }
+    }
+
+    for(uint32_t operation = 0; operation < 2; ++operation) {
+        g_test_processor.bus.value[0x0100] = operation ? 0xD6 : 0xC6;
+        g_test_processor.bus.value[0x0102] = 0x27;
+
+        for(uint32_t left = 0; left < 100; ++left) {
+
+            for(uint32_t right = 0; right < 100; ++right) {
+                uint32_t value = operation ? ((left + 100 - right) % 100) : ((left + right) % 100);
+                bool carry = operation ? (left < right) : ((left + right) > 99);
+
+                g_test_processor.bus.value[0x0101] = ((right / 10) << 4) | (right % 10);
+
+                if(DMGL_ASSERT(dmgl_test_execute(((((left / 10) << 4) | (left % 10)) << 8), 3)
+                        == (((((value / 10) << 4) | (value % 10)) << 8) | (!value ? 0x80 : 0) | (operation ? 0x40 : 0) | (carry ? 0x10 : 0)))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+            }
+        }
     }
 
-    for(uint32_t cycle = 2; cycle > 0; --cycle) {
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test processor clock.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_clock(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+
+    for(uint32_t cycle = 1; cycle <= 4; ++cycle) {
 
         if(DMGL_ASSERT((dmgl_processor_clock(&g_test_processor.processor) == DMGL_SUCCESS)
-                && (g_test_processor.processor.cycle == cycle))) {
+                && (g_test_processor.processor.instruction.cycle == 0)
+                && (g_test_processor.processor.instruction.address.word == 0x0100 + cycle)
+                && (g_test_processor.processor.bank.pc.word == 0x0101 + cycle))) {
             result = DMGL_FAILURE;
             goto exit;
         }
     }
 
-    if(DMGL_ASSERT((dmgl_processor_clock(&g_test_processor.processor) == DMGL_SUCCESS)
-            && (g_test_processor.processor.cycle == 0))) {
+#if PROFILE
+
+    if(DMGL_ASSERT((g_test_processor.processor.profile.count[0][0x00] == 4)
+            && (g_test_processor.processor.profile.cycle[0][0x00] == 4)
+            && (g_test_processor.processor.profile.count[1][0x00] == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+#endif /* PROFILE */
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test processor fork.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_fork(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_processor.processor.block = (dmgl_processor_block_t *)&g_test_processor.expected;
+    g_test_processor.expected.bus = (dmgl_bus_t *)&g_test_processor.bus;
+    dmgl_processor_fork(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus);
+
+    if(DMGL_ASSERT((dmgl_test_match() == DMGL_SUCCESS)
+            && (g_test_processor.processor.block == NULL))) {
         result = DMGL_FAILURE;
         goto exit;
     }
@@ -343,7 +504,7 @@ static dmgl_error_e dmgl_test_processor_initialize(void)
     dmgl_error_e result = DMGL_SUCCESS;
 
     dmgl_test_initialize();
-    g_test_processor.expected.cycle = 3;
+    g_test_processor.expected.bus = (dmgl_bus_t *)&g_test_processor.bus;
     g_test_processor.expected.bank.af.word = 0x0180;
     g_test_processor.expected.bank.bc.word = 0x0013;
     g_test_processor.expected.bank.de.word = 0x00D8;
@@ -352,15 +513,16 @@ static dmgl_error_e dmgl_test_processor_initialize(void)
     g_test_processor.expected.bank.sp.word = 0xFFFE;
     g_test_processor.expected.instruction.address.word = 0x0100;
     g_test_processor.expected.interrupt.flag.raw = 0xE1;
-    dmgl_processor_initialize(&g_test_processor.processor, false, 0x00);
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
 
-    if(DMGL_ASSERT(dmgl_test_match() == DMGL_SUCCESS)) {
+    if(DMGL_ASSERT((dmgl_test_match() == DMGL_SUCCESS)
+            && (g_test_processor.bus.context == g_test_processor.expected.bus))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
     dmgl_test_initialize();
-    g_test_processor.expected.cycle = 3;
+    g_test_processor.expected.bus = (dmgl_bus_t *)&g_test_processor.bus;
     g_test_processor.expected.checksum = 0x01;
     g_test_processor.expected.bank.af.word = 0x01B0;
     g_test_processor.expected.bank.bc.word = 0x0013;
@@ -370,20 +532,22 @@ static dmgl_error_e dmgl_test_processor_initialize(void)
     g_test_processor.expected.bank.sp.word = 0xFFFE;
     g_test_processor.expected.instruction.address.word = 0x0100;
     g_test_processor.expected.interrupt.flag.raw = 0xE1;
-    dmgl_processor_initialize(&g_test_processor.processor, false, 0x01);
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, false, 0x01);
 
-    if(DMGL_ASSERT(dmgl_test_match() == DMGL_SUCCESS)) {
+    if(DMGL_ASSERT((dmgl_test_match() == DMGL_SUCCESS)
+            && (g_test_processor.bus.context == g_test_processor.expected.bus))) {
         result = DMGL_FAILURE;
         goto exit;
     }
 
     dmgl_test_initialize();
-    g_test_processor.expected.cycle = 3;
+    g_test_processor.expected.bus = (dmgl_bus_t *)&g_test_processor.bus;
     g_test_processor.expected.has_bootloader = true;
     g_test_processor.expected.bank.pc.word = 0x0001;
-    dmgl_processor_initialize(&g_test_processor.processor, true, 0x00);
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, true, 0x00);
 
-    if(DMGL_ASSERT(dmgl_test_match() == DMGL_SUCCESS)) {
+    if(DMGL_ASSERT((dmgl_test_match() == DMGL_SUCCESS)
+            && (g_test_processor.bus.context == g_test_processor.expected.bus))) {
         result = DMGL_FAILURE;
         goto exit;
     }
@@ -418,8 +582,6 @@ static dmgl_error_e dmgl_test_processor_interrupt(void)
         g_test_processor.expected.interrupt.enabled = true;
 
         for(uint32_t cycle = 0; cycle < 5; ++cycle) {
-            g_test_processor.processor.cycle = 0;
-            g_test_processor.expected.cycle = 3;
 
             if(DMGL_ASSERT(dmgl_processor_clock(&g_test_processor.processor) == DMGL_SUCCESS)) {
                 result = DMGL_FAILURE;
@@ -486,6 +648,216 @@ exit:
     return result;
 }
 
+#if JIT && defined(__x86_64__)
+
+/*!
+ * @brief Test processor JIT matches processor clock, in lockstep, looping over a short program so its blocks turn hot.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_jit(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const uint8_t opcode[] = {
+        0x80, 0x89, 0x92, 0x9B, 0x84, 0x8D, 0x97, 0x98, 0xB9, 0xC6, 0x12, 0xCE, 0x07, 0xD6, 0x34, 0xDE,
+        0x99, 0xFE, 0x40, 0xA0, 0xA9, 0xB2, 0x2F, 0x37, 0x3F, 0xE6, 0x5A, 0xEE, 0x3C, 0xF6, 0x81, 0x8F,
+        0x9F, 0xBD, 0x00, 0xF3, 0x85, 0x93, 0xAC, 0xB3, 0xA5, 0x8A, 0x9C, 0xBA,
+        };
+    const uint8_t separator[] = { 0xFB, 0x27, 0xA6, 0xC5, };
+    const uint32_t cycles = 256 * 1024, length = sizeof(opcode) + sizeof(separator);
+    dmgl_processor_t *processor[] = { &g_test_processor.processor, &g_test_processor.expected, };
+    uint32_t pass = 0;
+
+    dmgl_test_initialize();
+
+    for(uint32_t address = 0x0100; address < 0x8000; ++address) {
+        uint32_t offset = (address - 0x0100) % length;
+
+        g_test_processor.bus.value[address] = (offset < sizeof(separator)) ? separator[offset] : opcode[offset - sizeof(separator)];
+    }
+
+    for(uint32_t index = 0; index < (sizeof(processor) / sizeof(*processor)); ++index) {
+        dmgl_processor_initialize(processor[index], (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+        processor[index]->bank.bc.word = 0x3A71;
+        processor[index]->bank.de.word = 0x95C3;
+        processor[index]->bank.hl.word = 0x4E2B;
+    }
+
+    for(uint32_t cycle = 0; cycle < cycles;) {
+        uint32_t elapsed = 0, limit = 4 * ((cycle % 61) + 1);
+
+        if(DMGL_ASSERT((dmgl_processor_run(&g_test_processor.processor, limit, &elapsed) == DMGL_SUCCESS)
+                && (elapsed > 0)
+                && (elapsed <= limit))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        for(cycle += elapsed; elapsed; elapsed -= 4) {
+
+            if(DMGL_ASSERT(dmgl_processor_clock(&g_test_processor.expected) == DMGL_SUCCESS)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+
+        if(DMGL_ASSERT(dmgl_test_match() == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        if(!g_test_processor.processor.instruction.cycle && !g_test_processor.processor.instruction.extended
+                && (g_test_processor.processor.instruction.address.word >= (0x0100 + (4 * length)))) {
+
+            if(DMGL_ASSERT(pass++ || !g_test_processor.processor.jit.length)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+
+            for(uint32_t index = 0; index < (sizeof(processor) / sizeof(*processor)); ++index) {
+                processor[index]->bank.pc.word = 0x0101;
+                processor[index]->instruction.address.word = 0x0100;
+                processor[index]->instruction.opcode = g_test_processor.bus.value[0x0100];
+            }
+        }
+    }
+
+    if(DMGL_ASSERT((pass > 16)
+            && (g_test_processor.processor.jit.disabled || (g_test_processor.processor.jit.length > 0)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_processor_uninitialize(&g_test_processor.processor);
+    dmgl_processor_uninitialize(&g_test_processor.expected);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+#endif /* JIT && __x86_64__ */
+
+/*!
+ * @brief Fill test bus with a program of lockstep-capable instruction runs, separated by EI, DAA, (HL) and DI, from 0x0100 to 0x7FFF.
+ */
+static void dmgl_test_lanes_program(void)
+{
+    const uint8_t opcode[] = {
+        0x80, 0x91, 0xA2, 0xB3, 0x88, 0x9D, 0xAC, 0xB8, 0x2F, 0x37, 0x3F, 0xC6, 0x12, 0xD6, 0x34, 0xEE,
+        0x5A, 0xCE, 0x07, 0xDE, 0x99, 0xFE, 0x40, 0x87, 0x00, 0x8F, 0x97, 0x9F, 0xA7, 0xBF, 0xE6, 0xF0,
+        0xF6, 0x0F, 0x84, 0x8B, 0x92, 0x99, 0xA8, 0xB1, 0xBA, 0x85, 0x81, 0x94,
+        };
+    const uint8_t separator[] = { 0xFB, 0x27, 0xB6, 0xF3, };
+    const uint32_t length = 4 * (sizeof(opcode) / sizeof(*opcode));
+
+    for(uint32_t address = 0x0100; address < 0x8000; ++address) {
+        uint32_t offset = (address - 0x0100) % (length + sizeof(separator));
+
+        g_test_processor.bus.value[address] = (offset < length) ? opcode[offset % (sizeof(opcode) / sizeof(*opcode))] : separator[offset - length];
+    }
+}
+
+/*!
+ * @brief Test processor lanes match processor run, lane for lane.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_lanes(void)
+{
+    static dmgl_processor_t lane[2][DMGL_PROCESSOR_LANES + 3] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    dmgl_processor_t *processor[DMGL_PROCESSOR_LANES + 3] = {};
+    uint32_t count = DMGL_PROCESSOR_LANES + 3, cycle[2][DMGL_PROCESSOR_LANES + 3] = {};
+    uint64_t limit[DMGL_PROCESSOR_LANES + 3] = {};
+
+    dmgl_test_initialize();
+    dmgl_test_lanes_program();
+
+    for(uint32_t index = 0; index < count; ++index) {
+
+        for(uint32_t set = 0; set < 2; ++set) {
+            dmgl_processor_initialize(&lane[set][index], (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+            lane[set][index].bank.af.high = index * 0x1D;
+            lane[set][index].bank.bc.word = index * 0x3A71;
+            lane[set][index].bank.de.word = index * 0x95C3;
+            lane[set][index].bank.hl.word = index * 0x4E2B;
+        }
+
+        processor[index] = &lane[1][index];
+    }
+
+    for(uint32_t step = 0; step < 16 * 1024; ++step) {
+
+        for(uint32_t index = 0; index < count; ++index) {
+            limit[index] = ((step % 7) && (index < 12)) ? 512 : (4 * (((step + index) % 13) + 1));
+
+            if(DMGL_ASSERT(dmgl_processor_run(&lane[0][index], limit[index], &cycle[0][index]) == DMGL_SUCCESS)) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+
+        if(DMGL_ASSERT(dmgl_processor_run_lanes(processor, count, limit, cycle[1]) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        for(uint32_t index = 0; index < count; ++index) {
+
+            if(DMGL_ASSERT((cycle[0][index] == cycle[1][index])
+                    && (lane[0][index].bank.af.word == lane[1][index].bank.af.word)
+                    && (lane[0][index].bank.bc.word == lane[1][index].bank.bc.word)
+                    && (lane[0][index].bank.de.word == lane[1][index].bank.de.word)
+                    && (lane[0][index].bank.hl.word == lane[1][index].bank.hl.word)
+                    && (lane[0][index].bank.pc.word == lane[1][index].bank.pc.word)
+                    && (lane[0][index].instruction.address.word == lane[1][index].instruction.address.word)
+                    && (lane[0][index].instruction.cycle == lane[1][index].instruction.cycle)
+                    && (lane[0][index].interrupt.enabled == lane[1][index].interrupt.enabled)
+                    && (lane[0][index].interrupt.enabling == lane[1][index].interrupt.enabling))) {
+                result = DMGL_FAILURE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+
+    for(uint32_t index = 0; index < count; ++index) {
+        dmgl_processor_uninitialize(&lane[0][index]);
+        dmgl_processor_uninitialize(&lane[1][index]);
+    }
+
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test processor load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_load(void)
+{
+    uint8_t data[sizeof(dmgl_processor_t)] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length;
+
+    dmgl_test_initialize();
+    dmgl_processor_reset(&g_test_processor.expected);
+    g_test_processor.expected.halt.enabled = true;
+    g_test_processor.expected.interrupt.enable.raw = 0x1F;
+    length = dmgl_processor_save(&g_test_processor.expected, data);
+
+    if(DMGL_ASSERT((dmgl_processor_load(&g_test_processor.processor, data) == length)
+            && (dmgl_test_match() == DMGL_SUCCESS))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test processor read.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -540,7 +912,6 @@ static dmgl_error_e dmgl_test_processor_reset(void)
     dmgl_error_e result = DMGL_SUCCESS;
 
     dmgl_test_initialize();
-    g_test_processor.expected.cycle = 3;
     g_test_processor.expected.bank.af.word = 0x0180;
     g_test_processor.expected.bank.bc.word = 0x0013;
     g_test_processor.expected.bank.de.word = 0x00D8;
@@ -557,7 +928,6 @@ static dmgl_error_e dmgl_test_processor_reset(void)
     }
 
     dmgl_test_initialize();
-    g_test_processor.expected.cycle = 3;
     g_test_processor.processor.checksum = 0x01;
     g_test_processor.expected.checksum = 0x01;
     g_test_processor.expected.bank.af.word = 0x01B0;
@@ -576,7 +946,6 @@ static dmgl_error_e dmgl_test_processor_reset(void)
     }
 
     dmgl_test_initialize();
-    g_test_processor.expected.cycle = 3;
     g_test_processor.processor.has_bootloader = true;
     g_test_processor.expected.has_bootloader = true;
     g_test_processor.expected.bank.pc.word = 0x0001;
@@ -593,6 +962,145 @@ exit:
     return result;
 }
 
+/*!
+ * @brief Test processor run matches processor clock, cycle for cycle.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_run(void)
+{
+    static uint8_t value[2][0x10000] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    const uint8_t opcode[] = {
+        0x00, 0xA0, 0xA9, 0xB2, 0x2F, 0x37, 0x3F, 0xE6, 0x5A, 0xAE, 0xFB, 0xEE, 0x3C, 0xB6, 0xC5, 0xD5,
+        0xF6, 0x81, 0xE1, 0xF1, 0xA6, 0xF3, 0xB5, 0xAF, 0x80, 0x27, 0xCE, 0x11, 0x96, 0xB9, 0x9C, 0xDE,
+        0x42, 0xFE, 0x10, 0x8F, 0xBE, 0x27,
+        };
+    const uint32_t cycles = 64 * 1024;
+    uint32_t cycle = 0;
+
+    dmgl_test_initialize();
+
+    for(uint32_t address = 0x0000; address < 0x8000; ++address) {
+        g_test_processor.bus.value[address] = opcode[address % (sizeof(opcode) / sizeof(*opcode))];
+    }
+
+    memcpy(value[0], g_test_processor.bus.value, sizeof(value[0]));
+    dmgl_processor_initialize(&g_test_processor.expected, (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+
+    for(cycle = 0; cycle < cycles; cycle += 4) {
+
+        if(DMGL_ASSERT(dmgl_processor_clock(&g_test_processor.expected) == DMGL_SUCCESS)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    memcpy(value[1], g_test_processor.bus.value, sizeof(value[1]));
+    memcpy(g_test_processor.bus.value, value[0], sizeof(value[0]));
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+
+    for(cycle = 0; cycle < cycles;) {
+        uint32_t elapsed = 0, limit = (cycles - cycle) < (4 * ((cycle % 13) + 1)) ? (cycles - cycle) : (4 * ((cycle % 13) + 1));
+
+        if(DMGL_ASSERT((dmgl_processor_run(&g_test_processor.processor, limit, &elapsed) == DMGL_SUCCESS)
+                && (elapsed > 0)
+                && (elapsed <= limit))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        cycle += elapsed;
+    }
+
+    if(DMGL_ASSERT((g_test_processor.processor.block != NULL)
+            && (dmgl_test_match() == DMGL_SUCCESS)
+            && !memcmp(g_test_processor.bus.value, value[1], sizeof(value[1])))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_processor_uninitialize(&g_test_processor.processor);
+    dmgl_processor_uninitialize(&g_test_processor.expected);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test processor run over an instruction that cannot be cached.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_run_uncacheable(void)
+{
+    uint32_t cycle = 0;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_processor.bus.value[0x0100] = 0xFB;
+    dmgl_processor_initialize(&g_test_processor.processor, (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+
+    if(DMGL_ASSERT((dmgl_processor_run(&g_test_processor.processor, 512, &cycle) == DMGL_SUCCESS)
+            && (cycle == 4)
+            && (g_test_processor.processor.block != NULL))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_processor.bus.value[0x0100] = 0x00;
+    g_test_processor.processor.bank.pc.word = 0x0100;
+    dmgl_processor_reset(&g_test_processor.processor);
+
+    if(DMGL_ASSERT((dmgl_processor_run(&g_test_processor.processor, 512, &cycle) == DMGL_SUCCESS)
+            && (cycle == 4))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_processor_initialize(&g_test_processor.expected, (dmgl_bus_t *)&g_test_processor.bus, false, 0x00);
+
+    if(DMGL_ASSERT((dmgl_processor_run(&g_test_processor.expected, 512, &cycle) == DMGL_SUCCESS)
+            && (cycle == (DMGL_PROCESSOR_BLOCK_LENGTH * 4)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    dmgl_processor_uninitialize(&g_test_processor.processor);
+    dmgl_processor_uninitialize(&g_test_processor.expected);
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test processor save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_processor_save(void)
+{
+    uint8_t data[sizeof(dmgl_processor_t)] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length;
+
+    dmgl_test_initialize();
+    dmgl_processor_reset(&g_test_processor.processor);
+    length = dmgl_processor_save(&g_test_processor.processor, NULL);
+
+    if(DMGL_ASSERT((length > 0)
+            && (length < sizeof(data))
+            && (dmgl_processor_save(&g_test_processor.processor, data) == length)
+            && !memcmp(data, &g_test_processor.processor.bank, length))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
 /*!
  * @brief Test processor uninitialize.
  * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
@@ -663,8 +1171,14 @@ int main(void)
 {
     dmgl_error_e result = DMGL_SUCCESS;
     const dmgl_test_cb tests[] = {
-        dmgl_test_processor_clock, dmgl_test_processor_initialize, dmgl_test_processor_interrupt, dmgl_test_processor_read,
-        dmgl_test_processor_reset, dmgl_test_processor_uninitialize, dmgl_test_processor_write,
+        dmgl_test_processor_alu, dmgl_test_processor_clock, dmgl_test_processor_fork,
+        dmgl_test_processor_initialize, dmgl_test_processor_interrupt,
+#if JIT && defined(__x86_64__)
+        dmgl_test_processor_jit,
+#endif /* JIT && __x86_64__ */
+        dmgl_test_processor_lanes, dmgl_test_processor_load, dmgl_test_processor_read,
+        dmgl_test_processor_reset,
+        dmgl_test_processor_run, dmgl_test_processor_run_uncacheable, dmgl_test_processor_save, dmgl_test_processor_uninitialize, dmgl_test_processor_write,
         };
 
     for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
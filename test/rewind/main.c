@@ -0,0 +1,323 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Common rewind test application.
+ */
+
+#include <rewind.h>
+#include <test.h>
+
+#define DMGL_TEST_LENGTH 256    /*!< Test state length, in bytes */
+
+/*!
+ * @struct dmgl_test_rewind_t
+ * @brief Rewind test context.
+ */
+typedef struct {
+    dmgl_rewind_t rewind;                       /*!< Rewind context */
+    uint8_t state[16][DMGL_TEST_LENGTH];        /*!< Rewind test states */
+
+    struct {
+        dmgl_error_e status;                    /*!< Rewind buffer status */
+    } buffer;                                   /*!< Rewind buffer */
+} dmgl_test_rewind_t;
+
+static dmgl_test_rewind_t g_test_rewind = {};   /*!< Rewind test context */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void *dmgl_buffer_allocate(size_t length)
+{
+    return (g_test_rewind.buffer.status == DMGL_SUCCESS) ? calloc(length, sizeof(uint8_t)) : NULL;
+}
+
+void dmgl_buffer_free(void *buffer)
+{
+    free(buffer);
+}
+
+dmgl_error_e dmgl_error_set(const char *file, const char *function, size_t line, const char *format, ...)
+{
+    return DMGL_FAILURE;
+}
+
+/*!
+ * @brief Initilalize test context.
+ */
+static inline void dmgl_test_initialize(void)
+{
+    dmgl_rewind_uninitialize(&g_test_rewind.rewind);
+    memset(&g_test_rewind, 0, sizeof(g_test_rewind));
+
+    for(size_t state = 0; state < 16; ++state) {
+
+        for(size_t index = 0; index < DMGL_TEST_LENGTH; ++index) {
+            g_test_rewind.state[state][index] = (index < 64) ? (index * 7) : 0;
+        }
+
+        for(size_t index = 0; index <= state; ++index) {
+            g_test_rewind.state[state][64 + (index * 11)] = state + 1;
+        }
+    }
+}
+
+/*!
+ * @brief Test common rewind count.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_rewind_count(void)
+{
+    uint8_t data[DMGL_TEST_LENGTH];
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 4, 64 * 1024);
+
+    for(uint32_t state = 0; state < 16; ++state) {
+
+        if(DMGL_ASSERT((state < 8) ? (dmgl_rewind_count(&g_test_rewind.rewind) == state)
+                : ((dmgl_rewind_count(&g_test_rewind.rewind) > 0) && (dmgl_rewind_count(&g_test_rewind.rewind) <= 8)))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+
+        dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[state]);
+    }
+
+    dmgl_test_initialize();
+    dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 4, 64 * 1024);
+    dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[0]);
+    dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[1]);
+    dmgl_rewind_pop(&g_test_rewind.rewind, data);
+
+    if(DMGL_ASSERT(dmgl_rewind_count(&g_test_rewind.rewind) == 1)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common rewind initialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_rewind_initialize(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_rewind_initialize(&g_test_rewind.rewind, 0, 8, 4, 64 * 1024) == DMGL_FAILURE)
+            && (dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 0, 4, 64 * 1024) == DMGL_FAILURE)
+            && (dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 0, 64 * 1024) == DMGL_FAILURE)
+            && (dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 4, DMGL_TEST_LENGTH) == DMGL_FAILURE))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_rewind.buffer.status = DMGL_FAILURE;
+
+    if(DMGL_ASSERT(dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 4, 64 * 1024) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+
+    if(DMGL_ASSERT((dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 4, 64 * 1024) == DMGL_SUCCESS)
+            && (g_test_rewind.rewind.length == DMGL_TEST_LENGTH)
+            && (g_test_rewind.rewind.interval == 4)
+            && (g_test_rewind.rewind.ring.capacity == (64 * 1024))
+            && (g_test_rewind.rewind.entry.capacity == 8)
+            && (dmgl_rewind_count(&g_test_rewind.rewind) == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common rewind pop.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_rewind_pop(void)
+{
+    uint8_t data[DMGL_TEST_LENGTH];
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 16, 4, 64 * 1024);
+
+    if(DMGL_ASSERT(dmgl_rewind_pop(&g_test_rewind.rewind, data) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(uint32_t state = 0; state < 16; ++state) {
+        dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[state]);
+    }
+
+    for(uint32_t state = 16; state > 8; --state) {
+
+        if(DMGL_ASSERT((dmgl_rewind_pop(&g_test_rewind.rewind, data) == DMGL_SUCCESS)
+                && !memcmp(data, g_test_rewind.state[state - 1], DMGL_TEST_LENGTH))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    for(uint32_t state = 8; state < 12; ++state) {
+        dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[state]);
+    }
+
+    for(uint32_t state = 12; state > 0; --state) {
+
+        if(DMGL_ASSERT((dmgl_rewind_pop(&g_test_rewind.rewind, data) == DMGL_SUCCESS)
+                && !memcmp(data, g_test_rewind.state[state - 1], DMGL_TEST_LENGTH))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    if(DMGL_ASSERT(dmgl_rewind_pop(&g_test_rewind.rewind, data) == DMGL_FAILURE)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common rewind push.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_rewind_push(void)
+{
+    uint8_t data[DMGL_TEST_LENGTH];
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 16, 4, 64 * 1024);
+
+    for(uint32_t state = 0; state < 16; ++state) {
+        dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[state]);
+
+        if(DMGL_ASSERT((g_test_rewind.rewind.entry.data[state].keyframe == !(state % 5))
+                && (g_test_rewind.rewind.entry.data[state].length < (g_test_rewind.rewind.entry.data[state].keyframe ? DMGL_TEST_LENGTH : 64)))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    dmgl_test_initialize();
+    dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 16, 4, (2 * DMGL_TEST_LENGTH) + 16);
+
+    for(uint32_t state = 0; state < 16; ++state) {
+        dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[state]);
+    }
+
+    if(DMGL_ASSERT((dmgl_rewind_count(&g_test_rewind.rewind) > 0)
+            && (dmgl_rewind_count(&g_test_rewind.rewind) < 16)
+            && g_test_rewind.rewind.entry.data[g_test_rewind.rewind.entry.first].keyframe)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(uint32_t state = 16; dmgl_rewind_count(&g_test_rewind.rewind); --state) {
+
+        if(DMGL_ASSERT((dmgl_rewind_pop(&g_test_rewind.rewind, data) == DMGL_SUCCESS)
+                && !memcmp(data, g_test_rewind.state[state - 1], DMGL_TEST_LENGTH))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test common rewind uninitialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_rewind_uninitialize(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_rewind_initialize(&g_test_rewind.rewind, DMGL_TEST_LENGTH, 8, 4, 64 * 1024);
+    dmgl_rewind_push(&g_test_rewind.rewind, g_test_rewind.state[0]);
+    dmgl_rewind_uninitialize(&g_test_rewind.rewind);
+
+    if(DMGL_ASSERT((g_test_rewind.rewind.ring.data == NULL)
+            && (g_test_rewind.rewind.entry.data == NULL)
+            && (g_test_rewind.rewind.keyframe == NULL)
+            && (dmgl_rewind_count(&g_test_rewind.rewind) == 0))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_rewind_count, dmgl_test_rewind_initialize, dmgl_test_rewind_pop, dmgl_test_rewind_push,
+        dmgl_test_rewind_uninitialize,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    dmgl_rewind_uninitialize(&g_test_rewind.rewind);
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
@@ -0,0 +1,547 @@
+/*
+ * DMGL
+ * Copyright (C) 2022 David Jolly
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+ * @file main.c
+ * @brief Video subsystem test application.
+ */
+
+#include <service.h>
+#include <video.h>
+#include <test.h>
+
+/*!
+ * @struct dmgl_test_video_t
+ * @brief Video test context.
+ */
+typedef struct {
+    dmgl_video_t video;                 /*!< Video context */
+
+    struct {
+        const dmgl_bus_t *context;      /*!< Video bus context */
+        uint8_t interrupt;              /*!< Video bus interrupt flags */
+        uint8_t value[0x10000];         /*!< Video bus value */
+        uint8_t tile[384][64];          /*!< Video bus tile color indices */
+
+        struct {
+            dmgl_event_e event;         /*!< Video bus schedule event */
+            uint32_t delay;             /*!< Video bus schedule delay */
+        } schedule;                     /*!< Video bus schedule */
+    } bus;                              /*!< Video bus */
+} dmgl_test_video_t;
+
+static dmgl_test_video_t g_test_video = {};   /*!< Video test context */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void dmgl_bus_interrupt(dmgl_bus_t *bus, dmgl_interrupt_e interrupt)
+{
+    g_test_video.bus.context = bus;
+    g_test_video.bus.interrupt |= (1 << interrupt);
+}
+
+uint8_t dmgl_bus_read(const dmgl_bus_t *bus, uint16_t address)
+{
+    g_test_video.bus.context = bus;
+
+    return g_test_video.bus.value[address];
+}
+
+void dmgl_bus_schedule(dmgl_bus_t *bus, dmgl_event_e event, uint32_t delay)
+{
+    g_test_video.bus.context = bus;
+    g_test_video.bus.schedule.event = event;
+    g_test_video.bus.schedule.delay = delay;
+}
+
+const uint8_t *dmgl_bus_tile(dmgl_bus_t *bus, uint16_t tile)
+{
+    g_test_video.bus.context = bus;
+
+    return g_test_video.bus.tile[tile];
+}
+
+void dmgl_bus_write(dmgl_bus_t *bus, uint16_t address, uint8_t value)
+{
+    g_test_video.bus.context = bus;
+    g_test_video.bus.value[address] = value;
+}
+
+/*!
+ * @brief Initilalize test context.
+ */
+static inline void dmgl_test_initialize(void)
+{
+    memset(&g_test_video, 0, sizeof(g_test_video));
+}
+
+/*!
+ * @brief Test video event.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_event(void)
+{
+    uint32_t cycle = 0;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, true);
+
+    if(DMGL_ASSERT(dmgl_video_event(&g_test_video.video) == 0)) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, false);
+
+    for(uint8_t y = 0; y < 144; ++y) {
+
+        if(DMGL_ASSERT((g_test_video.video.line.y == y)
+                && (g_test_video.video.status.mode == DMGL_VIDEO_SEARCH)
+                && ((cycle += dmgl_video_event(&g_test_video.video)) == (y * 456) + 172)
+                && (g_test_video.video.status.mode == DMGL_VIDEO_TRANSFER)
+                && ((cycle += dmgl_video_event(&g_test_video.video)) == (y * 456) + 376)
+                && (g_test_video.video.status.mode == DMGL_VIDEO_HBLANK)
+                && ((cycle += dmgl_video_event(&g_test_video.video)) == (y * 456) + ((y < 143) ? 456 : 832)))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    if(DMGL_ASSERT((g_test_video.video.line.y == 144)
+            && (g_test_video.video.status.mode == DMGL_VIDEO_VBLANK)
+            && (g_test_video.bus.interrupt == (1 << DMGL_INTERRUPT_VBLANK)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    for(uint8_t y = 145; y <= 153; ++y) {
+
+        if(DMGL_ASSERT((dmgl_video_event(&g_test_video.video) == 456)
+                && (g_test_video.video.line.y == y)
+                && (g_test_video.video.status.mode == DMGL_VIDEO_VBLANK))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+    if(DMGL_ASSERT((dmgl_video_event(&g_test_video.video) == 80)
+            && (g_test_video.video.line.y == 0)
+            && (g_test_video.video.status.mode == DMGL_VIDEO_SEARCH))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    dmgl_test_initialize();
+    dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, false);
+    g_test_video.video.status.hblank_interrupt = true;
+    g_test_video.video.status.coincidence_interrupt = true;
+    g_test_video.video.line.coincidence = 1;
+    dmgl_video_event(&g_test_video.video);
+    dmgl_video_event(&g_test_video.video);
+
+    if(DMGL_ASSERT(g_test_video.bus.interrupt == (1 << DMGL_INTERRUPT_SCREEN))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_video.bus.interrupt = 0;
+    g_test_video.video.status.hblank_interrupt = false;
+    dmgl_video_event(&g_test_video.video);
+
+    if(DMGL_ASSERT((g_test_video.video.status.coincidence == true)
+            && (g_test_video.bus.interrupt == (1 << DMGL_INTERRUPT_SCREEN)))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video initialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_initialize(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(int has_bootloader = false; has_bootloader <= true; ++has_bootloader) {
+        dmgl_test_initialize();
+        dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, has_bootloader);
+
+        if(DMGL_ASSERT((g_test_video.video.bus == (dmgl_bus_t *)&g_test_video.bus)
+                && (g_test_video.video.has_bootloader == has_bootloader)
+                && (g_test_video.video.control.raw == (has_bootloader ? 0x00 : 0x91))
+                && (g_test_video.video.palette.background == (has_bootloader ? 0x00 : 0xFC))
+                && (g_test_video.video.status.mode == (has_bootloader ? DMGL_VIDEO_HBLANK : DMGL_VIDEO_SEARCH)))) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video load.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_load(void)
+{
+    static dmgl_video_t video = {};
+    uint8_t data[sizeof(dmgl_video_t)] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length;
+
+    dmgl_test_initialize();
+    dmgl_video_reset(&video);
+    video.scroll.y = 0x12;
+    video.window.x = 0x34;
+    video.line.y = 0x56;
+    video.palette.object[1] = 0x78;
+    length = dmgl_video_save(&video, data);
+    g_test_video.video.bus = (dmgl_bus_t *)&g_test_video.bus;
+    g_test_video.video.pixel[0][0] = DMGL_COLOR_BLACK;
+
+    if(DMGL_ASSERT((dmgl_video_load(&g_test_video.video, data) == length)
+            && (g_test_video.video.bus == (dmgl_bus_t *)&g_test_video.bus)
+            && (g_test_video.video.control.raw == 0x91)
+            && (g_test_video.video.palette.background == 0xFC)
+            && (g_test_video.video.palette.object[1] == 0x78)
+            && (g_test_video.video.scroll.y == 0x12)
+            && (g_test_video.video.window.x == 0x34)
+            && (g_test_video.video.line.y == 0x56)
+            && (g_test_video.video.pixel[0][0] == DMGL_COLOR_BLACK))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video read.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_read(void)
+{
+    uint8_t data = 0x00;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0xFF40; address <= 0xFF4B; ++address, ++data) {
+        dmgl_test_initialize();
+
+        switch(address) {
+            case 0xFF40:
+                g_test_video.video.control.raw = data;
+                break;
+            case 0xFF41:
+                g_test_video.video.status.raw = data;
+                data |= 0x80;
+                break;
+            case 0xFF42:
+                g_test_video.video.scroll.y = data;
+                break;
+            case 0xFF43:
+                g_test_video.video.scroll.x = data;
+                break;
+            case 0xFF44:
+                g_test_video.video.line.y = data;
+                break;
+            case 0xFF45:
+                g_test_video.video.line.coincidence = data;
+                break;
+            case 0xFF46:
+                g_test_video.video.dma = data;
+                break;
+            case 0xFF47:
+                g_test_video.video.palette.background = data;
+                break;
+            case 0xFF48 ... 0xFF49:
+                g_test_video.video.palette.object[address - 0xFF48] = data;
+                break;
+            case 0xFF4A:
+                g_test_video.video.window.y = data;
+                break;
+            case 0xFF4B:
+                g_test_video.video.window.x = data;
+                break;
+            default:
+                break;
+        }
+
+        if(DMGL_ASSERT(dmgl_video_read(&g_test_video.video, address) == data)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video render.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_render(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, false);
+    g_test_video.video.palette.background = 0xE4;
+    g_test_video.video.palette.object[1] = 0x1B;
+    g_test_video.video.control.object_enabled = true;
+    g_test_video.video.scroll.x = 4;
+    g_test_video.bus.value[0x9800] = 1;
+    g_test_video.bus.value[0xFE00] = 16;
+    g_test_video.bus.value[0xFE01] = 8 + 8;
+    g_test_video.bus.value[0xFE02] = 2;
+    g_test_video.bus.value[0xFE03] = 0x30;
+
+    for(uint8_t x = 0; x < 8; ++x) {
+        g_test_video.bus.tile[1][x] = x & 3;
+        g_test_video.bus.tile[2][x] = (x < 4) ? 0 : 1;
+    }
+
+    dmgl_video_event(&g_test_video.video);
+    dmgl_video_event(&g_test_video.video);
+
+    for(uint8_t x = 0; x < 160; ++x) {
+        uint8_t color = DMGL_COLOR_WHITE;
+
+        if(x < 4) {
+            color = DMGL_COLOR_WHITE - ((x + 4) & 3);
+        } else if((x >= 8) && (x < 12)) {
+            color = DMGL_COLOR_WHITE - 2;
+        }
+
+        if(DMGL_ASSERT(g_test_video.video.pixel[0][x] == color)) {
+            result = DMGL_FAILURE;
+            goto exit;
+        }
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video reset.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_reset(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    g_test_video.video.scroll.x = 0xAB;
+    g_test_video.video.window.line = 0xCD;
+    g_test_video.video.pixel[143][159] = DMGL_COLOR_BLACK;
+    dmgl_video_reset(&g_test_video.video);
+
+    if(DMGL_ASSERT((g_test_video.video.control.raw == 0x91)
+            && (g_test_video.video.palette.background == 0xFC)
+            && (g_test_video.video.scroll.x == 0)
+            && (g_test_video.video.window.line == 0)
+            && (g_test_video.video.line.y == 0)
+            && (g_test_video.video.status.mode == DMGL_VIDEO_SEARCH)
+            && (g_test_video.video.pixel[143][159] == DMGL_COLOR_WHITE))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video save.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_save(void)
+{
+    uint8_t data[sizeof(dmgl_video_t)] = {};
+    dmgl_error_e result = DMGL_SUCCESS;
+    size_t length;
+
+    dmgl_test_initialize();
+    dmgl_video_reset(&g_test_video.video);
+    length = dmgl_video_save(&g_test_video.video, NULL);
+
+    if(DMGL_ASSERT((length > 0)
+            && (length < sizeof(g_test_video.video.pixel))
+            && (dmgl_video_save(&g_test_video.video, data) == length)
+            && !memcmp(data, &g_test_video.video.control, length))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video uninitialize.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_uninitialize(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    dmgl_test_initialize();
+    dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, false);
+    dmgl_video_uninitialize(&g_test_video.video);
+
+    if(DMGL_ASSERT((g_test_video.video.bus == NULL)
+            && (g_test_video.video.control.raw == 0x00))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+/*!
+ * @brief Test video write.
+ * @return DMGL_SUCCESS on success, DMGL_FAILURE otherwise
+ */
+static dmgl_error_e dmgl_test_video_write(void)
+{
+    uint8_t data = 0x00;
+    dmgl_error_e result = DMGL_SUCCESS;
+
+    for(uint32_t address = 0xFF41; address <= 0xFF4B; ++address, ++data) {
+        dmgl_test_initialize();
+        dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, false);
+        dmgl_video_write(&g_test_video.video, address, data);
+
+        switch(address) {
+            case 0xFF41:
+
+                if(DMGL_ASSERT(g_test_video.video.status.raw == ((data & 0x78) | 0x06))) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0xFF44:
+
+                if(DMGL_ASSERT(g_test_video.video.line.y == 0)) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+            case 0xFF46:
+
+                for(uint16_t offset = 0; offset < 0xA0; ++offset) {
+
+                    if(DMGL_ASSERT(g_test_video.bus.value[0xFE00 + offset] == g_test_video.bus.value[(data << 8) + offset])) {
+                        result = DMGL_FAILURE;
+                        goto exit;
+                    }
+                }
+                break;
+            default:
+
+                if(DMGL_ASSERT(dmgl_video_read(&g_test_video.video, address) == data)) {
+                    result = DMGL_FAILURE;
+                    goto exit;
+                }
+                break;
+        }
+    }
+
+    dmgl_test_initialize();
+    dmgl_video_initialize(&g_test_video.video, (dmgl_bus_t *)&g_test_video.bus, true);
+    dmgl_video_write(&g_test_video.video, 0xFF40, 0x91);
+
+    if(DMGL_ASSERT((g_test_video.video.control.raw == 0x91)
+            && (g_test_video.video.status.mode == DMGL_VIDEO_SEARCH)
+            && (g_test_video.bus.context == (dmgl_bus_t *)&g_test_video.bus)
+            && (g_test_video.bus.schedule.event == DMGL_EVENT_VIDEO)
+            && (g_test_video.bus.schedule.delay == 80))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+    g_test_video.video.pixel[0][0] = DMGL_COLOR_BLACK;
+    dmgl_video_write(&g_test_video.video, 0xFF40, 0x11);
+
+    if(DMGL_ASSERT((g_test_video.video.control.raw == 0x11)
+            && (g_test_video.video.status.mode == DMGL_VIDEO_HBLANK)
+            && (g_test_video.video.pixel[0][0] == DMGL_COLOR_WHITE))) {
+        result = DMGL_FAILURE;
+        goto exit;
+    }
+
+exit:
+    DMGL_TEST_RESULT(result);
+
+    return result;
+}
+
+int main(void)
+{
+    dmgl_error_e result = DMGL_SUCCESS;
+    const dmgl_test_cb tests[] = {
+        dmgl_test_video_event, dmgl_test_video_initialize, dmgl_test_video_load, dmgl_test_video_read,
+        dmgl_test_video_render, dmgl_test_video_reset, dmgl_test_video_save, dmgl_test_video_uninitialize,
+        dmgl_test_video_write,
+        };
+
+    for(int index = 0; index < (sizeof(tests) / sizeof(*(tests))); ++index) {
+
+        if(tests[index]() == DMGL_FAILURE) {
+            result = DMGL_FAILURE;
+        }
+    }
+
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */